@@ -14,6 +14,7 @@
 #include "abcg_image.hpp"
 #include "abcg_openglwindow.hpp"
 #include "abcg_string.hpp"
+#include "abcg_taskpool.hpp"
 #include "abcg_trackball.hpp"
 
 #endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "SDL_image.h"
 #include "abcg_exception.hpp"
 #include "abcg_openglwindow.hpp"
+#include "abcg_taskpool.hpp"
 #include "tiny_obj_loader.h"
 
 #if defined(__EMSCRIPTEN__)
@@ -102,6 +103,8 @@ void abcg::Application::mainLoopIterator([[maybe_unused]] bool &done) {
 #endif
     m_window->handleEvent(event, done);
   }
+  // Completion callbacks of background tasks run here, on the main thread
+  abcg::TaskPool::processMainThreadCallbacks();
   m_window->paint();
 }
 
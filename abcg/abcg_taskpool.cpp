@@ -0,0 +1,202 @@
+/**
+ * @file abcg_taskpool.cpp
+ * @brief Definition of abcg::TaskPool class members.
+ *
+ * This project is released under the MIT License.
+ */
+
+#include "abcg_taskpool.hpp"
+
+namespace {
+// Callbacks waiting to run on the main thread, shared by all pools
+std::mutex mainThreadMutex;
+std::deque<std::function<void()>> mainThreadCallbacks;
+
+// Pool and deque index of the current thread, if it is a worker
+thread_local const abcg::TaskPool *currentPool{};
+thread_local std::size_t currentIndex{};
+}  // namespace
+
+/**
+ * @brief Constructs an abcg::TaskPool object.
+ *
+ * @param threadCount Number of worker threads. If zero, or if threads are
+ * not available (Emscripten without pthreads), tasks run on the main thread
+ * when abcg::TaskPool::processMainThreadCallbacks is called.
+ */
+abcg::TaskPool::TaskPool([[maybe_unused]] unsigned threadCount) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  threadCount = 0;
+#endif
+  m_queues.reserve(threadCount);
+  for (unsigned index{}; index < threadCount; ++index) {
+    m_queues.push_back(std::make_unique<Queue>());
+  }
+  m_threads.reserve(threadCount);
+  for (std::size_t index{}; index < threadCount; ++index) {
+    m_threads.emplace_back([this, index] { workerLoop(index); });
+  }
+}
+
+/**
+ * @brief Destroys the abcg::TaskPool object.
+ *
+ * Runs the tasks still queued and joins the worker threads.
+ */
+abcg::TaskPool::~TaskPool() {
+  {
+    const std::scoped_lock lock{m_sleepMutex};
+    m_stop = true;
+  }
+  m_wakeUp.notify_all();
+  for (auto &thread : m_threads) thread.join();
+}
+
+/**
+ * @brief Returns the pool shared by the application.
+ *
+ * The pool is created on first use with one worker per hardware thread.
+ */
+abcg::TaskPool &abcg::TaskPool::instance() {
+  static TaskPool pool;
+  return pool;
+}
+
+/**
+ * @brief Queues a callback to run on the main thread.
+ *
+ * May be called from any thread.
+ *
+ * @param callback Callable object with no parameters.
+ */
+void abcg::TaskPool::runOnMainThread(std::function<void()> callback) {
+  const std::scoped_lock lock{mainThreadMutex};
+  mainThreadCallbacks.push_back(std::move(callback));
+}
+
+/**
+ * @brief Runs the callbacks queued for the main thread.
+ *
+ * Called by abcg::Application once per frame. Callbacks queued while this
+ * function runs are left for the next call.
+ *
+ * @return Number of callbacks that were run.
+ */
+std::size_t abcg::TaskPool::processMainThreadCallbacks() {
+  std::size_t count{};
+  {
+    const std::scoped_lock lock{mainThreadMutex};
+    count = mainThreadCallbacks.size();
+  }
+  // Callbacks are taken one at a time so that a callback that waits on a
+  // future can process the remaining ones
+  std::size_t processed{};
+  for (; processed < count; ++processed) {
+    std::function<void()> callback;
+    {
+      const std::scoped_lock lock{mainThreadMutex};
+      if (mainThreadCallbacks.empty()) break;
+      callback = std::move(mainThreadCallbacks.front());
+      mainThreadCallbacks.pop_front();
+    }
+    callback();
+  }
+  return processed;
+}
+
+/**
+ * @brief Queues a task without a future.
+ *
+ * The task must not throw; use abcg::TaskPool::submit to get exceptions
+ * back through an abcg::TaskFuture.
+ *
+ * @param task Callable object with no parameters.
+ */
+void abcg::TaskPool::post(std::function<void()> task) {
+  if (m_threads.empty()) {
+    runOnMainThread(std::move(task));
+    return;
+  }
+
+  // Workers push to their own deque; other threads spread the load
+  const auto index{workerIndex().value_or(m_nextQueue++ % m_queues.size())};
+  {
+    auto &queue{*m_queues[index]};
+    const std::scoped_lock lock{queue.mutex};
+    queue.tasks.push_back(std::move(task));
+    ++m_pending;
+  }
+  {
+    // Taking the lock avoids a lost wake-up between a worker's check of
+    // m_pending and its wait
+    const std::scoped_lock lock{m_sleepMutex};
+  }
+  m_wakeUp.notify_one();
+}
+
+/**
+ * @brief Runs one pending task on the calling thread, if there is any.
+ *
+ * Used by abcg::TaskFuture::get to make progress while waiting.
+ *
+ * @return Whether a task was run.
+ */
+bool abcg::TaskPool::runPendingTask() {
+  if (m_threads.empty()) return false;
+
+  const auto index{workerIndex()};
+  auto task{takeTask(index.value_or(m_nextQueue % m_queues.size()),
+                     index.has_value())};
+  if (!task) return false;
+  (*task)();
+  return true;
+}
+
+std::optional<std::function<void()>> abcg::TaskPool::takeTask(
+    std::size_t first, bool own) {
+  auto take{[this](Queue &queue, bool back) {
+    std::optional<std::function<void()>> task;
+    const std::scoped_lock lock{queue.mutex};
+    if (queue.tasks.empty()) return task;
+    if (back) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    --m_pending;
+    return task;
+  }};
+
+  // A worker takes its newest task (still hot in cache); thieves take the
+  // oldest tasks of the other deques
+  if (own) {
+    if (auto task{take(*m_queues[first], true)}) return task;
+  }
+  const auto count{m_queues.size()};
+  for (std::size_t step{own ? 1U : 0U}; step < count; ++step) {
+    if (auto task{take(*m_queues[(first + step) % count], false)}) return task;
+  }
+  return std::nullopt;
+}
+
+void abcg::TaskPool::workerLoop(std::size_t index) {
+  currentPool = this;
+  currentIndex = index;
+
+  while (true) {
+    if (auto task{takeTask(index, true)}) {
+      (*task)();
+      continue;
+    }
+    std::unique_lock lock{m_sleepMutex};
+    m_wakeUp.wait(lock, [this] { return m_stop || m_pending > 0; });
+    if (m_stop && m_pending == 0) return;
+  }
+}
+
+std::optional<std::size_t> abcg::TaskPool::workerIndex() const {
+  if (currentPool == this) return currentIndex;
+  return std::nullopt;
+}
@@ -0,0 +1,320 @@
+/**
+ * @file abcg_taskpool.hpp
+ * @brief abcg::TaskPool header file.
+ *
+ * Declaration of abcg::TaskPool and abcg::TaskFuture classes.
+ *
+ * This project is released under the MIT License.
+ */
+
+#ifndef ABCG_TASKPOOL_HPP_
+#define ABCG_TASKPOOL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "abcg_exception.hpp"
+
+namespace abcg {
+class TaskPool;
+template <typename T>
+class TaskFuture;
+
+namespace detail {
+template <typename T>
+struct TaskState;
+}  // namespace detail
+}  // namespace abcg
+
+/**
+ * @brief Shared state between a task and its abcg::TaskFuture objects.
+ *
+ * Holds the result (or the exception) of a task and the continuations to
+ * schedule once the result is available.
+ */
+template <typename T>
+struct abcg::detail::TaskState {
+  using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+  std::mutex mutex;
+  std::condition_variable readyCondition;
+  bool ready{};
+  std::optional<Value> value;
+  std::exception_ptr exception;
+  std::vector<std::function<void()>> continuations;
+
+  template <typename F>
+  void run(F &function) {
+    try {
+      if constexpr (std::is_void_v<T>) {
+        function();
+        finish(std::monostate{}, nullptr);
+      } else {
+        finish(function(), nullptr);
+      }
+    } catch (...) {
+      finish(std::nullopt, std::current_exception());
+    }
+  }
+
+  void finish(std::optional<Value> result, std::exception_ptr error) {
+    std::vector<std::function<void()>> pending;
+    {
+      const std::scoped_lock lock{mutex};
+      value = std::move(result);
+      exception = std::move(error);
+      ready = true;
+      pending.swap(continuations);
+    }
+    readyCondition.notify_all();
+    for (auto &continuation : pending) continuation();
+  }
+
+  void onReady(std::function<void()> continuation) {
+    {
+      const std::scoped_lock lock{mutex};
+      if (!ready) {
+        continuations.push_back(std::move(continuation));
+        return;
+      }
+    }
+    continuation();
+  }
+};
+
+/**
+ * @brief abcg::TaskPool class.
+ *
+ * Work-stealing executor. Each worker thread owns a deque of tasks: it
+ * pushes and pops its own tasks at the back and, when its deque is empty,
+ * steals from the front of the other deques. Tasks submitted from other
+ * threads are distributed among the deques in round-robin order.
+ *
+ * Results are returned as abcg::TaskFuture objects that accept
+ * continuations, either on the pool or on the main thread. Main-thread
+ * callbacks are run by abcg::Application once per frame, before
+ * abcg::OpenGLWindow::paint, so they can safely touch window and OpenGL
+ * state.
+ *
+ * When threads are not available (Emscripten builds without pthreads) the
+ * pool has no workers and each task runs on the main thread as a
+ * main-thread callback.
+ *
+ * Tasks and continuations must be copy-constructible.
+ */
+class abcg::TaskPool {
+ public:
+  explicit TaskPool(unsigned threadCount = std::thread::hardware_concurrency());
+  ~TaskPool();
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool(TaskPool &&) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+  TaskPool &operator=(TaskPool &&) = delete;
+
+  static TaskPool &instance();
+  static void runOnMainThread(std::function<void()> callback);
+  static std::size_t processMainThreadCallbacks();
+
+  template <typename F>
+  auto submit(F &&task) -> TaskFuture<std::invoke_result_t<std::decay_t<F>>>;
+  void post(std::function<void()> task);
+  bool runPendingTask();
+
+  [[nodiscard]] std::size_t threadCount() const { return m_threads.size(); }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  std::vector<std::thread> m_threads;
+  std::atomic<std::size_t> m_pending{};
+  std::atomic<std::size_t> m_nextQueue{};
+
+  std::mutex m_sleepMutex;
+  std::condition_variable m_wakeUp;
+  bool m_stop{};
+
+  std::optional<std::function<void()>> takeTask(std::size_t first, bool own);
+  void workerLoop(std::size_t index);
+  [[nodiscard]] std::optional<std::size_t> workerIndex() const;
+};
+
+/**
+ * @brief abcg::TaskFuture class.
+ *
+ * Handle to the result of a task submitted to an abcg::TaskPool.
+ *
+ * Copies refer to the same result. Exceptions thrown by the task are
+ * rethrown by get() and propagated to continuations, which are then not
+ * called.
+ */
+template <typename T>
+class abcg::TaskFuture {
+ public:
+  TaskFuture() = default;
+  TaskFuture(TaskPool *pool, std::shared_ptr<detail::TaskState<T>> state)
+      : m_pool{pool}, m_state{std::move(state)} {}
+
+  [[nodiscard]] bool valid() const { return m_state != nullptr; }
+  [[nodiscard]] bool isReady() const;
+  decltype(auto) get() const;
+
+  template <typename F>
+  auto then(F &&continuation) const;
+  template <typename F>
+  auto thenOnMainThread(F &&continuation) const;
+
+ private:
+  TaskPool *m_pool{};
+  std::shared_ptr<detail::TaskState<T>> m_state;
+
+  void wait() const;
+  template <typename F, typename S>
+  auto chain(F &&continuation, S schedule) const;
+};
+
+/**
+ * @brief Submits a task to the pool.
+ *
+ * @param task Callable object with no parameters.
+ *
+ * @return Future of the value returned by the task.
+ */
+template <typename F>
+auto abcg::TaskPool::submit(F &&task)
+    -> TaskFuture<std::invoke_result_t<std::decay_t<F>>> {
+  using R = std::invoke_result_t<std::decay_t<F>>;
+  auto state{std::make_shared<detail::TaskState<R>>()};
+  post([state, function = std::forward<F>(task)]() mutable {
+    state->run(function);
+  });
+  return TaskFuture<R>{this, std::move(state)};
+}
+
+/**
+ * @brief Returns whether the result of the task is available.
+ */
+template <typename T>
+bool abcg::TaskFuture<T>::isReady() const {
+  const std::scoped_lock lock{m_state->mutex};
+  return m_state->ready;
+}
+
+/**
+ * @brief Waits for the task and returns its result.
+ *
+ * While waiting, the calling thread runs other pending tasks of the pool.
+ *
+ * @return Const reference to the result, or nothing if T is void.
+ *
+ * @throw Any exception thrown by the task.
+ */
+template <typename T>
+decltype(auto) abcg::TaskFuture<T>::get() const {
+  wait();
+  if (m_state->exception) std::rethrow_exception(m_state->exception);
+  if constexpr (!std::is_void_v<T>) {
+    return static_cast<const T &>(*m_state->value);
+  }
+}
+
+template <typename T>
+void abcg::TaskFuture<T>::wait() const {
+  using namespace std::chrono_literals;
+  while (!isReady()) {
+    if (m_pool->runPendingTask()) continue;
+    if (m_pool->threadCount() == 0) {
+      // Without workers, the only way forward is the main-thread queue
+      if (TaskPool::processMainThreadCallbacks() == 0 && !isReady()) {
+        throw abcg::Exception{
+            abcg::Exception::Runtime("TaskFuture::get would never return")};
+      }
+      continue;
+    }
+    std::unique_lock lock{m_state->mutex};
+    m_state->readyCondition.wait_for(lock, 1ms,
+                                     [this] { return m_state->ready; });
+  }
+}
+
+/**
+ * @brief Schedules a continuation on the pool.
+ *
+ * @param continuation Callable object that receives a const reference to
+ * the result (or no parameter if T is void).
+ *
+ * @return Future of the value returned by the continuation.
+ */
+template <typename T>
+template <typename F>
+auto abcg::TaskFuture<T>::then(F &&continuation) const {
+  return chain(std::forward<F>(continuation),
+               [pool = m_pool](std::function<void()> task) {
+                 pool->post(std::move(task));
+               });
+}
+
+/**
+ * @brief Schedules a continuation on the main thread.
+ *
+ * The continuation runs during the next call to
+ * abcg::TaskPool::processMainThreadCallbacks after the result is available.
+ *
+ * @param continuation Callable object that receives a const reference to
+ * the result (or no parameter if T is void).
+ *
+ * @return Future of the value returned by the continuation.
+ */
+template <typename T>
+template <typename F>
+auto abcg::TaskFuture<T>::thenOnMainThread(F &&continuation) const {
+  return chain(std::forward<F>(continuation), [](std::function<void()> task) {
+    TaskPool::runOnMainThread(std::move(task));
+  });
+}
+
+template <typename T>
+template <typename F, typename S>
+auto abcg::TaskFuture<T>::chain(F &&continuation, S schedule) const {
+  using Function = std::decay_t<F>;
+  using R = typename std::conditional_t<
+      std::is_void_v<T>, std::invoke_result<Function>,
+      std::invoke_result<Function, const T &>>::type;
+
+  auto next{std::make_shared<detail::TaskState<R>>()};
+  auto job{[antecedent = m_state, next,
+            function = std::forward<F>(continuation)]() mutable {
+    if (antecedent->exception) {
+      next->finish(std::nullopt, antecedent->exception);
+      return;
+    }
+    auto call{[&]() -> R {
+      if constexpr (std::is_void_v<T>) {
+        return function();
+      } else {
+        return function(static_cast<const T &>(*antecedent->value));
+      }
+    }};
+    next->run(call);
+  }};
+  m_state->onReady([schedule, job]() mutable { schedule(std::move(job)); });
+  return TaskFuture<R>{m_pool, std::move(next)};
+}
+
+#endif
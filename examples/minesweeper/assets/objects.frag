@@ -1,7 +1,90 @@
-#version 410
-
-in vec4 fragColor;
-
-out vec4 outColor;
-
-void main() { outColor = fragColor; }
\ No newline at end of file
+#version 410
+
+flat in uint fragCell;
+in vec2 fragUV;
+
+uniform bool showAll; // fim de jogo: mostra as bombas e os números ocultos
+uniform sampler2D glyphs; // atlas de SDFs (glyphs.hpp): dígitos 1-8, bandeira, bomba
+// highp como no vertex shader: uniforms dos dois estágios têm que ter a
+// mesma precisão, e a padrão de int aqui seria mediump no WebGL 2
+uniform highp int unit; // > 1: fragCell é o resumo de um bloco, não uma célula
+
+out vec4 outColor;
+
+// bits de cell.hpp
+const uint countMask = 0x0Fu;
+const uint mineBit = 0x10u;
+const uint revealedBit = 0x20u;
+const uint flagBit = 0x40u;
+const uint borderBit = 0x80u;  // dentro do tabuleiro: célula ainda não gerada (modo infinito)
+
+const float glyphCount = 10.0;
+const float glyphSize = 32.0;
+const int flagGlyph = 8;
+const int mineGlyph = 9;
+
+const vec3 corDoNumero[8] = vec3[8](
+    vec3(0.35, 0.55, 1.0), vec3(0.3, 0.8, 0.3), vec3(1.0, 0.35, 0.3),
+    vec3(0.6, 0.4, 1.0), vec3(0.85, 0.3, 0.2), vec3(0.3, 0.8, 0.8),
+    vec3(0.9, 0.9, 0.9), vec3(0.6, 0.6, 0.6));
+
+// cobertura do glifo g na posição uv da célula: o contorno (0.5 no atlas)
+// é suavizado em cerca de um pixel da tela, qualquer que seja o zoom
+float glifo(int g, vec2 uv) {
+  // meio texel de margem para o filtro não pegar o glifo vizinho
+  vec2 p = clamp(uv, vec2(0.5 / glyphSize), vec2(1.0 - 0.5 / glyphSize));
+  float d = texture(glyphs, vec2((float(g) + p.x) / glyphCount, p.y)).r;
+  float w = max(fwidth(d), 1.0 / 255.0);
+  return smoothstep(0.5 - w, 0.5 + w, d);
+}
+
+void main() {
+  bool revelada = (fragCell & revealedBit) != 0u;
+  bool bomba = (fragCell & mineBit) != 0u;
+  bool bandeira = (fragCell & flagBit) != 0u && !revelada;
+  bool visivel = revelada || showAll;
+  uint n = fragCell & countMask;
+
+  // o glifo é amostrado fora dos desvios, onde as derivadas de fwidth valem
+  int g = bandeira ? flagGlyph : bomba ? mineGlyph : max(int(n) - 1, 0);
+  float cobertura = glifo(g, fragUV);
+
+  // nível de detalhe: o bloco é pintado pela fração revelada (bits 0-5),
+  // com um tom laranja se há bandeiras e vermelho se uma bomba explodiu
+  if (unit > 1) {
+    vec3 cor = mix(vec3(0.5, 0.5, 0.52), vec3(0.22, 0.22, 0.25), float(fragCell & 0x3Fu) / 63.0);
+    if ((fragCell & 0x40u) != 0u) cor = mix(cor, vec3(1.0, 0.45, 0.1), 0.35);
+    if ((fragCell & 0x80u) != 0u) cor = vec3(0.8, 0.1, 0.1);
+    outColor = vec4(cor, 1);
+    return;
+  }
+
+  // linhas entre as células
+  if (any(lessThan(fragUV, vec2(0.04))) || any(greaterThan(fragUV, vec2(0.96)))) {
+    outColor = vec4(0.08, 0.08, 0.1, 1);
+    return;
+  }
+
+  if ((fragCell & borderBit) != 0u) {
+    outColor = vec4(0.25, 0.27, 0.35, 1);
+    return;
+  }
+
+  if (bandeira) {
+    outColor = vec4(mix(vec3(0.5), vec3(1.0, 0.45, 0.1), cobertura), 1);
+    return;
+  }
+
+  if (!visivel) {
+    outColor = vec4(0.5, 0.5, 0.52, 1);
+    return;
+  }
+
+  // células reveladas e, no fim de jogo, as ocultas um pouco mais escuras
+  float brilho = revelada ? 1.0 : 0.6;
+  vec3 fundo = bomba && revelada ? vec3(0.8, 0.1, 0.1) : vec3(0.22, 0.22, 0.25);
+  vec3 cor = fundo;
+  if (bomba) cor = mix(fundo, vec3(0.02), cobertura);
+  else if (n > 0u) cor = mix(fundo, corDoNumero[n - 1u], cobertura);
+  outColor = vec4(cor * brilho, 1);
+}
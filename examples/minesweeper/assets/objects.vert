@@ -1,21 +1,31 @@
-#version 410
-
-layout(location = 0) in vec2 inPosition;
-
-uniform vec4 color;
-uniform float rotation;
-uniform float scale;
-uniform vec2 translation;
-
-out vec4 fragColor;
-
-void main() {
-  float sinAngle = sin(rotation);
-  float cosAngle = cos(rotation);
-  vec2 rotated = vec2(inPosition.x * cosAngle - inPosition.y * sinAngle,
-                      inPosition.x * sinAngle + inPosition.y * cosAngle);
-
-  vec2 newPosition = rotated * scale + translation;
-  gl_Position = vec4(newPosition, 0, 1);
-  fragColor = color;
-}
\ No newline at end of file
+#version 410
+
+precision highp usampler2D;
+
+// canto do quadrado de uma unidade, de (0, 0) a (1, 1); cada instância é uma
+// unidade visível do tabuleiro (uma célula, ou um bloco de unit x unit
+// células no nível de detalhe), em ordem de linhas a partir de firstUnit
+layout(location = 0) in vec2 inPosition;
+
+uniform usampler2D cells; // uma célula por texel no formato de cell.hpp, com a moldura
+uniform usampler2D tiles; // resumo de cada bloco, sem moldura (boardrenderer.cpp)
+uniform ivec2 boardSize; // largura e altura do tabuleiro, sem a moldura
+uniform int unit; // células por lado de uma instância: 1, ou o tamanho do bloco
+uniform ivec2 firstUnit; // primeira unidade visível (coluna, linha)
+uniform int columns; // unidades visíveis por linha
+uniform vec2 viewOrigin; // célula no canto superior esquerdo do viewport
+uniform vec2 viewSpan; // células que cabem no viewport
+
+flat out uint fragCell;
+out vec2 fragUV; // posição dentro da célula, (0, 0) no canto superior esquerdo
+
+void main() {
+  ivec2 u = firstUnit + ivec2(gl_InstanceID % columns, gl_InstanceID / columns);
+  fragCell = unit == 1 ? texelFetch(cells, u + 1, 0).r : texelFetch(tiles, u, 0).r;
+  fragUV = inPosition;
+
+  // o último bloco de cada linha e coluna pode ser parcial; a linha 0 fica em cima
+  vec2 canto = min(vec2(u * unit) + inPosition * float(unit), vec2(boardSize));
+  vec2 p = (canto - viewOrigin) / viewSpan;
+  gl_Position = vec4(p.x * 2.0 - 1.0, 1.0 - p.y * 2.0, 0, 1);
+}
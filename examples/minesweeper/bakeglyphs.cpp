@@ -0,0 +1,150 @@
+// Gera o atlas de glifos das células (glyphs.hpp): os dígitos 1 a 8 saem da
+// fonte dada (os SDFs do stb_truetype que vem com o ImGui), a bandeira e a
+// bomba de formas geométricas com distância exata. A saída são os
+// glyphs::width x glyphs::height bytes crus do atlas.
+//
+// Uso: minesweeper_bakeglyphs ../../abcg/assets/Inconsolata-Medium.ttf glyphs.sdf
+//
+// O atlas já gerado fica no repositório e é embutido no jogo; só é preciso
+// rodar de novo ao mudar a fonte ou os glifos (e apagar glyphatlas.hpp para
+// o CMake regenerá-lo).
+
+#include <fmt/core.h>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imgui/imstb_truetype.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "glyphs.hpp"
+
+namespace {
+
+using Atlas = std::vector<std::uint8_t>;
+
+// distância com sinal (negativa dentro) de formas simples, em texels
+float caixa(float x, float y, float cx, float cy, float hx, float hy) {
+  const auto qx{std::abs(x - cx) - hx};
+  const auto qy{std::abs(y - cy) - hy};
+  return std::hypot(std::max(qx, 0.0f), std::max(qy, 0.0f)) + std::min(std::max(qx, qy), 0.0f);
+}
+
+float circulo(float x, float y, float cx, float cy, float r) { return std::hypot(x - cx, y - cy) - r; }
+
+float segmento(float x, float y, float ax, float ay, float bx, float by) {
+  const auto px{x - ax};
+  const auto py{y - ay};
+  const auto dx{bx - ax};
+  const auto dy{by - ay};
+  const auto t{std::clamp((px * dx + py * dy) / (dx * dx + dy * dy), 0.0f, 1.0f)};
+  return std::hypot(px - t * dx, py - t * dy);
+}
+
+float triangulo(float x, float y, const float (&v)[6]) {
+  const auto d{std::min({segmento(x, y, v[0], v[1], v[2], v[3]), segmento(x, y, v[2], v[3], v[4], v[5]),
+                         segmento(x, y, v[4], v[5], v[0], v[1])})};
+  // dentro se estiver do mesmo lado das três arestas
+  auto lado = [&](int a, int b) {
+    return (v[b] - v[a]) * (y - v[a + 1]) - (v[b + 1] - v[a + 1]) * (x - v[a]);
+  };
+  const auto l0{lado(0, 2)}, l1{lado(2, 4)}, l2{lado(4, 0)};
+  const bool dentro{(l0 >= 0 && l1 >= 0 && l2 >= 0) || (l0 <= 0 && l1 <= 0 && l2 <= 0)};
+  return dentro ? -d : d;
+}
+
+float bomba(float x, float y) {
+  constexpr float c{glyphs::size / 2.0f};
+  auto d{circulo(x, y, c, c, 7.0f)};
+  d = std::min(d, caixa(x, y, c, c, 11.0f, 1.2f));
+  d = std::min(d, caixa(x, y, c, c, 1.2f, 11.0f));
+  // pontas diagonais: a mesma caixa com o ponto girado 45 graus
+  const auto rx{(x - c + y - c) * 0.70710678f + c};
+  const auto ry{(y - c - (x - c)) * 0.70710678f + c};
+  d = std::min(d, caixa(rx, ry, c, c, 9.5f, 1.2f));
+  d = std::min(d, caixa(rx, ry, c, c, 1.2f, 9.5f));
+  return d;
+}
+
+float bandeira(float x, float y) {
+  constexpr float flamula[6]{14.0f, 5.0f, 14.0f, 16.0f, 25.0f, 10.5f};
+  auto d{caixa(x, y, 13.0f, 15.5f, 1.0f, 9.5f)}; // mastro
+  d = std::min(d, caixa(x, y, 14.0f, 25.5f, 6.0f, 1.5f)); // base
+  d = std::min(d, triangulo(x, y, flamula));
+  return d;
+}
+
+std::uint8_t codificar(float distanciaDentro) {
+  const auto v{128.0f + distanciaDentro * (127.0f / glyphs::spread)};
+  return static_cast<std::uint8_t>(std::clamp(std::lround(v), 0L, 255L));
+}
+
+template <typename Forma>
+void desenharForma(Atlas &atlas, int indice, Forma forma) {
+  for(int y = 0; y < glyphs::size; ++y)
+    for(int x = 0; x < glyphs::size; ++x)
+      atlas[y * glyphs::width + indice * glyphs::size + x] = codificar(-forma(x + 0.5f, y + 0.5f));
+}
+
+// SDF do dígito centrado na sua célula do atlas; false se não couber
+bool desenharDigito(Atlas &atlas, const stbtt_fontinfo &fonte, int digito) {
+  const auto escala{stbtt_ScaleForPixelHeight(&fonte, 27.0f)};
+  int largura{}, altura{}, dx{}, dy{};
+  auto *sdf{stbtt_GetCodepointSDF(&fonte, escala, '0' + digito, glyphs::spread, 128,
+                                  127.0f / glyphs::spread, &largura, &altura, &dx, &dy)};
+  if(sdf == nullptr || largura > glyphs::size || altura > glyphs::size)
+  {
+    stbtt_FreeSDF(sdf, nullptr);
+    return false;
+  }
+  const auto x0{(glyphs::size - largura) / 2};
+  const auto y0{(glyphs::size - altura) / 2};
+  for(int y = 0; y < altura; ++y)
+    std::copy_n(sdf + y * largura, largura,
+                atlas.begin() + (y0 + y) * glyphs::width + (digito - 1) * glyphs::size + x0);
+  stbtt_FreeSDF(sdf, nullptr);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if(argc != 3)
+  {
+    fmt::print(stderr, "Uso: {} fonte.ttf saida.sdf\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream entrada{argv[1], std::ios::binary};
+  const std::vector<unsigned char> ttf{std::istreambuf_iterator<char>{entrada}, {}};
+  stbtt_fontinfo fonte;
+  if(ttf.empty() || stbtt_InitFont(&fonte, ttf.data(), stbtt_GetFontOffsetForIndex(ttf.data(), 0)) == 0)
+  {
+    fmt::print(stderr, "Fonte invalida: {}\n", argv[1]);
+    return 1;
+  }
+
+  Atlas atlas(static_cast<std::size_t>(glyphs::width) * glyphs::height, 0);
+  for(int digito = 1; digito <= 8; ++digito)
+    if(!desenharDigito(atlas, fonte, digito))
+    {
+      fmt::print(stderr, "O digito {} nao cabe em {}x{} texels\n", digito, glyphs::size, glyphs::size);
+      return 1;
+    }
+  desenharForma(atlas, glyphs::flag, bandeira);
+  desenharForma(atlas, glyphs::mine, bomba);
+
+  std::ofstream saida{argv[2], std::ios::binary};
+  saida.write(reinterpret_cast<const char *>(atlas.data()), static_cast<std::streamsize>(atlas.size()));
+  if(!saida)
+  {
+    fmt::print(stderr, "Erro ao gravar {}\n", argv[2]);
+    return 1;
+  }
+  fmt::print("Atlas {}x{} gravado em {}\n", glyphs::width, glyphs::height, argv[2]);
+  return 0;
+}
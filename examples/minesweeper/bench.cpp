@@ -0,0 +1,420 @@
+// Benchmarks do núcleo do campo minado: geração, revelação, contagem de
+// vizinhos, checagem de fim de jogo, solver, probabilidades, desfazer,
+// regiões alteradas e arquivos de tabuleiro, para vários tamanhos de
+// tabuleiro e densidades de bombas. Não precisa de janela nem de contexto
+// OpenGL.
+//
+// Uso: minesweeper_bench [--json] [--filter=texto] [--max-size=N]
+//                        [--min-time=segundos]
+// Com --json a saída segue o formato do Google Benchmark, para ser
+// comparada entre commits.
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "board.hpp"
+#include "boardfile.hpp"
+#include "dirtyregions.hpp"
+#include "generator.hpp"
+#include "history.hpp"
+#include "neighborcount.hpp"
+#include "probability.hpp"
+#include "solver.hpp"
+
+namespace {
+
+using Relogio = std::chrono::steady_clock;
+
+struct Opcoes {
+  bool json{false};
+  std::string filtro;
+  int tamanhoMaximo{8192};
+  double tempoMinimo{0.2};  // segundos medidos por benchmark
+};
+
+struct Resultado {
+  std::string nome;
+  long iteracoes{};
+  double nsPorIteracao{};
+  double itensPorSegundo{};
+};
+
+// Cada benchmark executa uma iteração e devolve quanto tempo (ns) foi de
+// fato medido, o que permite deixar a preparação de fora da medida
+using Iteracao = std::function<double()>;
+
+double medirNs(const std::function<void()> &trecho) {
+  const auto inicio{Relogio::now()};
+  trecho();
+  return std::chrono::duration<double, std::nano>(Relogio::now() - inicio)
+      .count();
+}
+
+Resultado executar(const Opcoes &opcoes, std::string nome, double itens,
+                   const Iteracao &iteracao) {
+  // repete até acumular o tempo mínimo medido, com um teto de tempo total
+  // para os casos em que a preparação domina
+  long iteracoes = 0;
+  double medido = 0.0;
+  const auto inicio{Relogio::now()};
+  const auto teto{std::chrono::duration<double>(opcoes.tempoMinimo * 20)};
+  do {
+    medido += iteracao();
+    ++iteracoes;
+  } while (medido < opcoes.tempoMinimo * 1e9 &&
+           Relogio::now() - inicio < teto);
+
+  const auto ns{medido / static_cast<double>(iteracoes)};
+  return {std::move(nome), iteracoes, ns, itens * 1e9 / ns};
+}
+
+int bombasPara(int largura, int altura, double densidade) {
+  return static_cast<int>(std::ceil(largura * altura * densidade));
+}
+
+// Referência sem a moldura de sentinelas: o mesmo preenchimento por faixas
+// de Board::reveal sobre uma grade largura x altura justa, com teste de
+// limite em cada vizinha. Só existe para medir o ganho da moldura
+// (BM_FloodRevealUnpadded contra BM_FloodReveal), então mantém os mesmos
+// contadores que o Board.
+class SemMoldura {
+ public:
+  explicit SemMoldura(const Board &board)
+      : m_largura{board.width()}, m_altura{board.height()} {
+    m_celulas.reserve(static_cast<std::size_t>(board.size()));
+    for (int i = 0; i < m_altura; ++i)
+      m_celulas.insert(m_celulas.end(), board.row(i), board.row(i) + m_largura);
+  }
+
+  const std::vector<int> &reveal(int offset) {
+    m_reveladas.clear();
+    m_fronteira.clear();
+    if ((m_celulas[offset] & bloqueada) != 0) return m_reveladas;
+    if (!cell::isZero(m_celulas[offset])) {
+      revelar(offset);
+      return m_reveladas;
+    }
+    m_fronteira.push_back(offset);
+    for (std::size_t k = 0; k < m_fronteira.size(); ++k) varrer(m_fronteira[k]);
+    return m_reveladas;
+  }
+
+ private:
+  static constexpr Cell bloqueada{cell::revealedBit | cell::flagBit};
+  int m_largura;
+  int m_altura;
+  std::vector<Cell> m_celulas;
+  std::vector<int> m_reveladas;
+  std::vector<int> m_fronteira;
+  bool m_explodiu{};
+  int m_reveladasSeguras{};
+
+  void revelar(int p) {
+    m_celulas[p] |= cell::revealedBit;
+    m_reveladas.push_back(p);
+    if (cell::isMine(m_celulas[p]))
+      m_explodiu = true;
+    else
+      ++m_reveladasSeguras;
+  }
+
+  void varrer(int p) {
+    if ((m_celulas[p] & bloqueada) != 0) return;
+    const int linha = p / m_largura;
+    const int inicioLinha = linha * m_largura;
+    revelar(p);
+    int esquerda = p;
+    while (esquerda > inicioLinha && (m_celulas[esquerda - 1] & bloqueada) == 0) {
+      revelar(esquerda - 1);
+      if (!cell::isZero(m_celulas[esquerda - 1])) break;
+      --esquerda;
+    }
+    int direita = p;
+    while (direita + 1 < inicioLinha + m_largura &&
+           (m_celulas[direita + 1] & bloqueada) == 0) {
+      revelar(direita + 1);
+      if (!cell::isZero(m_celulas[direita + 1])) break;
+      ++direita;
+    }
+    for (const int vizinha : {linha - 1, linha + 1}) {
+      if (vizinha < 0 || vizinha >= m_altura) continue;
+      const int base = vizinha * m_largura;
+      const int primeira = std::max(esquerda - inicioLinha - 1, 0);
+      const int ultima = std::min(direita - inicioLinha + 1, m_largura - 1);
+      bool emFaixa = false;
+      for (int j = primeira; j <= ultima; ++j) {
+        const int v = base + j;
+        if ((m_celulas[v] & bloqueada) != 0) {
+          emFaixa = false;
+        } else if (cell::isZero(m_celulas[v])) {
+          if (!emFaixa) m_fronteira.push_back(v);
+          emFaixa = true;
+        } else {
+          revelar(v);
+          emFaixa = false;
+        }
+      }
+    }
+  }
+};
+
+void benchmarks(const Opcoes &opcoes, std::vector<Resultado> &resultados) {
+  const std::vector<int> tamanhos{9, 16, 64, 256, 1024, 4096, 8192};
+  const std::vector<double> densidades{0.05, 0.12, 0.20};
+
+  auto rodar = [&](const std::string &nome, double itens,
+                   const Iteracao &iteracao) {
+    if (nome.find(opcoes.filtro) == std::string::npos) return;
+    resultados.push_back(executar(opcoes, nome, itens, iteracao));
+    if (!opcoes.json) {
+      const auto &r{resultados.back()};
+      fmt::print("{:<36} {:>14.0f} ns {:>10} it {:>14.3e} itens/s\n", r.nome,
+                 r.nsPorIteracao, r.iteracoes, r.itensPorSegundo);
+    }
+  };
+
+  for (const auto n : tamanhos) {
+    if (n > opcoes.tamanhoMaximo) continue;
+    const double celulas{static_cast<double>(n) * n};
+
+    for (const auto densidade : densidades) {
+      const auto bombas{bombasPara(n, n, densidade)};
+      const auto sufixo{fmt::format("{}x{}/{:.0f}%", n, n, densidade * 100)};
+      const int centro = (n / 2) * n + n / 2;
+
+      // geração: sorteio das bombas + contagem de vizinhos
+      Board board(n, n, bombas);
+      std::uint64_t semente = 1;
+      rodar("BM_Generate/" + sufixo, celulas, [&] {
+        board.reset(n, n, bombas);
+        return medirNs([&] { board.fill(centro, semente++, 1); });
+      });
+
+      // revelação a partir do primeiro clique (zona segura garante um zero);
+      // itens = células que ela abre, não o tamanho do tabuleiro
+      Board modelo(n, n, bombas);
+      modelo.fill(centro, 42, 1);
+      Board copia{modelo};
+      const std::vector<int> alteradas{copia.reveal(centro)};
+      const auto abertas{static_cast<double>(std::max<std::size_t>(1, alteradas.size()))};
+      rodar("BM_FloodReveal/" + sufixo, abertas, [&] {
+        copia = modelo;
+        return medirNs([&] { copia.reveal(centro); });
+      });
+
+      // registrar, desfazer e refazer o preenchimento do primeiro clique
+      Board aberto{modelo};
+      History historico;
+      historico.recordReveal(aberto.reveal(centro));
+      rodar("BM_RecordReveal/" + sufixo, abertas, [&] {
+        copia = modelo;
+        const auto &reveladas{copia.reveal(centro)};
+        return medirNs([&] {
+          historico.clear();
+          historico.recordReveal(reveladas);
+        });
+      });
+      rodar("BM_UndoRedo/" + sufixo, abertas, [&] {
+        return medirNs([&] {
+          historico.undo(aberto);
+          historico.redo(aberto);
+        });
+      });
+
+      // retângulos que o preenchimento do primeiro clique manda para a GPU
+      DirtyRegions regioes;
+      regioes.reset(n, n);
+      rodar("BM_DirtyRegions/" + sufixo, abertas, [&] {
+        return medirNs([&] {
+          regioes.mark(alteradas);
+          static_cast<void>(regioes.take());
+        });
+      });
+
+      // gravar e carregar a partida depois do primeiro clique (3 bits por
+      // célula no arquivo)
+      const auto arquivo{
+          (std::filesystem::temp_directory_path() / "minesweeper_bench.sav")
+              .string()};
+      rodar("BM_SaveBoard/" + sufixo, celulas, [&] {
+        return medirNs([&] { saveBoard(arquivo, aberto, 42); });
+      });
+      rodar("BM_LoadBoard/" + sufixo, celulas, [&] {
+        return medirNs([&] { loadBoard(arquivo, board); });
+      });
+      std::filesystem::remove(arquivo);
+
+      // partida completa clicando só em células seguras, com checagem de fim
+      // de jogo a cada clique (itens = cliques)
+      if (n <= 1024) {
+        std::vector<int> seguras;
+        for (int i = 0; i < modelo.size(); ++i)
+          if (!modelo.isMine(i)) seguras.push_back(i);
+        std::shuffle(seguras.begin(), seguras.end(), std::mt19937{7});
+        rodar("BM_PlayToWin/" + sufixo, static_cast<double>(seguras.size()),
+              [&] {
+                copia = modelo;
+                return medirNs([&] {
+                  for (const auto offset : seguras) {
+                    copia.reveal(offset);
+                    if (copia.exploded() || copia.cleared()) break;
+                  }
+                });
+              });
+
+        // solver: do primeiro clique até travar (precisar de chute) ou ganhar
+        Solver solver;
+        rodar("BM_Solve/" + sufixo, celulas, [&] {
+          copia = modelo;
+          return medirNs([&] {
+            copia.reveal(centro);
+            solver.reset(copia);
+            for (int segura = solver.nextSafe(copia); segura >= 0;
+                 segura = solver.nextSafe(copia))
+              solver.update(copia, copia.reveal(segura));
+          });
+        });
+
+        // probabilidades exatas no ponto em que o solver trava
+        Board travado{modelo};
+        travado.reveal(centro);
+        solver.reset(travado);
+        for (int segura = solver.nextSafe(travado); segura >= 0;
+             segura = solver.nextSafe(travado))
+          solver.update(travado, travado.reveal(segura));
+        Probability probabilidade;
+        rodar("BM_Probability/" + sufixo, celulas, [&] {
+          return medirNs([&] { probabilidade.compute(travado, solver); });
+        });
+      }
+    }
+
+    // meta da revelação: uma região vazia de 4M de células (2000x2000 sem
+    // bombas) num só núcleo, com e sem a moldura de sentinelas
+    if (n == 1024 && opcoes.tamanhoMaximo >= 2000) {
+      constexpr int lado{2000};
+      const int meio = (lado / 2) * lado + lado / 2;
+      for (const auto densidade : {0.0, 0.05}) {
+        const auto sufixo{fmt::format("{}x{}/{:.0f}%", lado, lado, densidade * 100)};
+        Board modelo(lado, lado, bombasPara(lado, lado, densidade));
+        modelo.fill(meio, 42, 1);
+        Board copia{modelo};
+        const auto abertas{static_cast<double>(copia.reveal(meio).size())};
+        rodar("BM_FloodReveal/" + sufixo, abertas, [&] {
+          copia = modelo;
+          return medirNs([&] { copia.reveal(meio); });
+        });
+        const SemMoldura referencia{modelo};
+        auto semMoldura{referencia};
+        if (static_cast<double>(semMoldura.reveal(meio).size()) != abertas) {
+          fmt::print(stderr, "revelação sem moldura difere de Board::reveal em {}\n",
+                     sufixo);
+          std::exit(1);
+        }
+        rodar("BM_FloodRevealUnpadded/" + sufixo, abertas, [&] {
+          semMoldura = referencia;
+          return medirNs([&] { semMoldura.reveal(meio); });
+        });
+      }
+    }
+
+    // geração sem chute no tamanho do Expert clássico (30x16, 99 bombas)
+    if (n == 16) {
+      Board expert(30, 16, 99);
+      std::uint64_t semente = 1;
+      rodar("BM_GenerateNoGuess/30x16/99", 30.0 * 16, [&] {
+        expert.reset(30, 16, 99);
+        return medirNs([&] { fillNoGuess(expert, 8 * 30 + 15, semente++, 1); });
+      });
+    }
+
+    // contagem de vizinhos (SIMD e escalar) sobre um mapa de bombas a 12%,
+    // conferindo que as duas implementações concordam
+    std::vector<Cell> bombas(static_cast<std::size_t>(n) * n, 0);
+    std::mt19937_64 gerador{3};
+    std::bernoulli_distribution sorteio{0.12};
+    for (auto &c : bombas)
+      if (sorteio(gerador)) c = cell::mineBit;
+    auto simd{bombas};
+    auto escalar{bombas};
+    const auto sufixo{fmt::format("{}x{}", n, n)};
+    rodar("BM_CountNeighbors/" + sufixo, celulas, [&] {
+      return medirNs([&] { countNeighbors(simd.data(), n, n, n); });
+    });
+    rodar("BM_CountNeighborsScalar/" + sufixo, celulas, [&] {
+      return medirNs([&] { countNeighborsScalar(escalar.data(), n, n, n); });
+    });
+    countNeighbors(simd.data(), n, n, n);
+    countNeighborsScalar(escalar.data(), n, n, n);
+    if (simd != escalar) {
+      fmt::print(stderr, "countNeighbors difere da referência em {}\n",
+                 sufixo);
+      std::exit(1);
+    }
+  }
+}
+
+void imprimirJson(const std::vector<Resultado> &resultados) {
+  const auto agora{std::chrono::system_clock::to_time_t(
+      std::chrono::system_clock::now())};
+  fmt::print("{{\n  \"context\": {{\n    \"date\": {},\n", agora);
+#if defined(NDEBUG)
+  fmt::print("    \"library_build_type\": \"release\"\n  }},\n");
+#else
+  fmt::print("    \"library_build_type\": \"debug\"\n  }},\n");
+#endif
+  fmt::print("  \"benchmarks\": [\n");
+  for (std::size_t i = 0; i < resultados.size(); ++i) {
+    const auto &r{resultados[i]};
+    fmt::print(
+        "    {{\n      \"name\": \"{}\",\n      \"run_type\": \"iteration\",\n"
+        "      \"iterations\": {},\n      \"real_time\": {:.3f},\n"
+        "      \"time_unit\": \"ns\",\n      \"items_per_second\": {:.6e}\n"
+        "    }}{}\n",
+        r.nome, r.iteracoes, r.nsPorIteracao, r.itensPorSegundo,
+        i + 1 < resultados.size() ? "," : "");
+  }
+  fmt::print("  ]\n}}\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Opcoes opcoes;
+  const std::vector<std::string_view> argumentos(argv + 1, argv + argc);
+  for (const auto argumento : argumentos) {
+    auto valor = [&](std::string_view prefixo) {
+      return std::string{argumento.substr(prefixo.size())};
+    };
+    if (argumento == "--json") {
+      opcoes.json = true;
+    } else if (argumento.starts_with("--filter=")) {
+      opcoes.filtro = valor("--filter=");
+    } else if (argumento.starts_with("--max-size=")) {
+      opcoes.tamanhoMaximo = std::stoi(valor("--max-size="));
+    } else if (argumento.starts_with("--min-time=")) {
+      opcoes.tempoMinimo = std::stod(valor("--min-time="));
+    } else {
+      fmt::print(stderr,
+                 "Uso: {} [--json] [--filter=texto] [--max-size=N] "
+                 "[--min-time=segundos]\n",
+                 argv[0]);
+      return 1;
+    }
+  }
+
+  std::vector<Resultado> resultados;
+  benchmarks(opcoes, resultados);
+  if (opcoes.json) imprimirJson(resultados);
+  return 0;
+}
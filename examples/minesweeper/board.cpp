@@ -0,0 +1,366 @@
+#include "board.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "neighborcount.hpp"
+
+namespace {
+// células que o preenchimento não abre: já reveladas ou marcadas com bandeira
+constexpr Cell bloqueada{cell::revealedBit | cell::flagBit};
+
+// as funções de bitmap leem e escrevem 8 células numa palavra de 64 bits,
+// com a célula k no byte k
+static_assert(std::endian::native == std::endian::little);
+
+// 8 células -> 8 bits (célula k no bit k) com o bit indicado por deslocamento
+unsigned juntar(std::uint64_t celulas, int deslocamento) {
+  const auto bits{(celulas >> deslocamento) & cell::broadcast(1)};
+  return static_cast<unsigned>((bits * UINT64_C(0x0102040810204080)) >> 56);
+}
+
+// 8 bits -> 8 células (bit k na célula k), com 1 ou 0 em cada byte
+std::uint64_t espalhar(unsigned bits) {
+  const auto diagonal{(bits * cell::broadcast(1)) & UINT64_C(0x8040201008040201)};
+  return ((diagonal + UINT64_C(0x7F7F7F7F7F7F7F7F)) >> 7) & cell::broadcast(1);
+}
+
+// lê quantos (até 8) bits a partir do bit posicao do bitmap
+unsigned lerBits(const std::uint8_t *bitmap, std::size_t posicao, int quantos) {
+  const auto byte{posicao >> 3};
+  const auto resto{static_cast<int>(posicao & 7)};
+  unsigned bits = bitmap[byte] >> resto;
+  if(resto + quantos > 8) bits |= static_cast<unsigned>(bitmap[byte + 1]) << (8 - resto);
+  return bits & ((1U << quantos) - 1);
+}
+
+// escreve quantos (até 8) bits a partir do bit posicao de um bitmap zerado
+void escreverBits(std::uint8_t *bitmap, std::size_t posicao, unsigned bits, int quantos) {
+  const auto byte{posicao >> 3};
+  const auto resto{static_cast<int>(posicao & 7)};
+  bitmap[byte] |= static_cast<std::uint8_t>(bits << resto);
+  if(resto + quantos > 8) bitmap[byte + 1] |= static_cast<std::uint8_t>(bits >> (8 - resto));
+}
+}  // namespace
+
+Board::Board(int width, int height, int mines) { reset(width, height, mines); }
+
+void Board::reset(int width, int height, int mines) {
+  m_width = width;
+  m_height = height;
+  m_mines = mines;
+  m_stride = width + 2;
+
+  // única realocação do tabuleiro: durante o jogo o vetor não muda de tamanho
+  m_cells.assign(static_cast<std::size_t>(m_stride) * (height + 2), 0);
+  clear();
+}
+
+void Board::clear() {
+  // moldura de sentinelas: "reveladas", então o preenchimento nunca sai do tabuleiro
+  constexpr Cell sentinela{cell::borderBit | cell::revealedBit};
+  std::fill(m_cells.begin(), m_cells.end(), sentinela);
+  for(int i = 0; i < m_height; ++i)
+    std::fill_n(m_cells.begin() + index(i, 0), m_width, Cell{0});
+
+  m_reveladasSeguras = 0;
+  m_bandeiras = 0;
+  m_explodiu = false;
+}
+
+template <class Engine>
+void Board::sortearBombas(int clicada, int safeRadius, Engine &engine) {
+  // lista de células que podem receber bomba: todas menos a zona segura
+  const int linhaClicada = clicada / m_width;
+  const int colunaClicada = clicada % m_width;
+  m_candidatas.clear();
+  m_candidatas.reserve(static_cast<std::size_t>(size()));
+  for(int i = 0; i < m_height; ++i)
+  {
+    const bool linhaSegura = std::abs(i - linhaClicada) <= safeRadius;
+    for(int j = 0; j < m_width; ++j)
+    {
+      if(linhaSegura && std::abs(j - colunaClicada) <= safeRadius) continue;
+      m_candidatas.push_back(index(i, j));
+    }
+  }
+  m_mines = std::min(m_mines, static_cast<int>(m_candidatas.size()));
+
+  // Fisher-Yates parcial: as m_mines primeiras posições viram uma amostra
+  // uniforme sem repetição, com custo fixo de m_mines sorteios
+  const auto total{m_candidatas.size()};
+  for(std::size_t i = 0; i < static_cast<std::size_t>(m_mines); ++i)
+  {
+    std::uniform_int_distribution<std::size_t> distribution(i, total - 1);
+    std::swap(m_candidatas[i], m_candidatas[distribution(engine)]);
+
+    m_cells[m_candidatas[i]] |= cell::mineBit;
+  }
+
+  // contagem de bombas vizinhas de todas as células numa única passada
+  countNeighbors(&m_cells[index(0, 0)], m_width, m_height, m_stride);
+}
+
+void Board::fill(int clicada, std::uint64_t seed, int safeRadius) {
+  std::mt19937_64 randomEngine{seed};
+  sortearBombas(clicada, safeRadius, randomEngine);
+}
+
+void Board::fill(int clicada, SplitMix64 &engine, int safeRadius) {
+  sortearBombas(clicada, safeRadius, engine);
+}
+
+const std::vector<int> &Board::revealBatch(std::span<const int> offsets) {
+  m_reveladas.clear();
+  m_fronteira.clear();
+  for(const int offset : offsets) semear(index(offset));
+  preencher();
+  return m_reveladas;
+}
+
+const std::vector<int> &Board::chord(int offset) {
+  m_reveladas.clear();
+  const int p = index(offset);
+  const Cell c = m_cells[p];
+  if(!cell::isRevealed(c) || cell::isMine(c) || cell::count(c) == 0) return m_reveladas;
+
+  // as 8 vizinhas a deslocamentos fixos; a moldura nunca tem bandeira e
+  // já conta como revelada
+  const std::array<int, 8> vizinhas{-m_stride - 1, -m_stride, -m_stride + 1, -1,
+                                    1, m_stride - 1, m_stride, m_stride + 1};
+  int bandeiras = 0;
+  for(const int d : vizinhas) bandeiras += cell::isFlagged(m_cells[p + d]) ? 1 : 0;
+  if(bandeiras != cell::count(c)) return m_reveladas;
+
+  m_fronteira.clear();
+  for(const int d : vizinhas) semear(p + d);
+  preencher();
+  return m_reveladas;
+}
+
+bool Board::toggleFlag(int offset) {
+  Cell &c = m_cells[index(offset)];
+  if(cell::isRevealed(c)) return false;
+  c ^= cell::flagBit;
+  m_bandeiras += cell::isFlagged(c) ? 1 : -1;
+  return true;
+}
+
+void Board::setRevealed(int offset, int count, bool revealed) {
+  // a faixa pode atravessar linhas: cada linha é contígua em m_cells
+  int linha = offset / m_width;
+  int coluna = offset % m_width;
+  while(count > 0)
+  {
+    const int n = std::min(count, m_width - coluna);
+    Cell *c = &m_cells[index(linha, coluna)];
+    for(int k = 0; k < n; ++k)
+    {
+      if(cell::isRevealed(c[k]) == revealed) continue;
+      c[k] ^= cell::revealedBit;
+      if(cell::isMine(c[k]))
+        m_explodiu = revealed; //o jogo acaba na revelação que acha bomba, então desfazê-la esconde todas
+      else
+        m_reveladasSeguras += revealed ? 1 : -1;
+    }
+    count -= n;
+    ++linha;
+    coluna = 0;
+  }
+}
+
+void Board::revealAll() {
+  // marca o bit de revelada 8 células por vez
+  const auto mascara{cell::broadcast(cell::revealedBit)};
+  const auto total{m_cells.size()};
+  std::size_t i = 0;
+  for(; i + sizeof(std::uint64_t) <= total; i += sizeof(std::uint64_t))
+  {
+    std::uint64_t palavra{};
+    std::memcpy(&palavra, &m_cells[i], sizeof(palavra));
+    palavra |= mascara;
+    std::memcpy(&m_cells[i], &palavra, sizeof(palavra));
+  }
+  for(; i < total; ++i)
+    m_cells[i] |= cell::revealedBit;
+}
+
+void Board::semear(int p)
+{
+  if((m_cells[p] & bloqueada) != 0) return;
+  if(cell::isZero(m_cells[p]))
+  {
+    m_fronteira.push_back(p);
+    return;
+  }
+  const int linha = p / m_stride - 1;
+  revelar(p, m_stride + 1 + 2 * linha);
+}
+
+void Board::preencher()
+{
+  // preenchimento iterativo por faixas (scanline): a fila guarda sementes de
+  // faixas de zeros ainda ocultas, então não há recursão nem risco de estouro
+  // de pilha. Com várias sementes, as regiões que se tocam são varridas uma
+  // vez só
+  for(std::size_t inicio = 0; inicio < m_fronteira.size(); ++inicio)
+    varrer_linha(m_fronteira[inicio]);
+}
+
+void Board::revelar(int p, int ajuste)
+{
+  m_cells[p] |= cell::revealedBit;
+  m_reveladas.push_back(p - ajuste);
+  if(cell::isMine(m_cells[p]))
+    m_explodiu = true;
+  else
+    ++m_reveladasSeguras;
+}
+
+void Board::varrer_linha(int p)
+{
+  // o ponteiro das células fica numa variável local: uma escrita num Cell
+  // (unsigned char) pode apelidar qualquer membro, e o compilador o
+  // recarregaria a cada célula revelada
+  Cell *celulas = m_cells.data();
+  if((celulas[p] & bloqueada) != 0) return; //faixa já varrida a partir de outra semente
+
+  // diferença entre o índice com moldura e o offset público, constante em
+  // cada linha: evita uma divisão por célula revelada
+  const int linha = p / m_stride - 1;
+  const int ajuste = m_stride + 1 + 2 * linha;
+  // toda célula revelada aqui toca um zero da faixa, então nunca é bomba: as
+  // seguras são contadas no fim, pelo tamanho de m_reveladas
+  const auto antes{m_reveladas.size()};
+  auto revelarAqui = [&](int q, int ajusteDe) {
+    celulas[q] |= cell::revealedBit;
+    m_reveladas.push_back(q - ajusteDe);
+  };
+
+  // estender a faixa de zeros para a esquerda e para a direita de p; a primeira
+  // célula não-zero de cada lado também é revelada e encerra a faixa. A
+  // moldura de sentinelas já conta como revelada, então não há teste de limite
+  int esquerda = p;
+  while((celulas[esquerda - 1] & bloqueada) == 0 && cell::isZero(celulas[esquerda - 1]))
+    --esquerda;
+  int direita = p;
+  while((celulas[direita + 1] & bloqueada) == 0 && cell::isZero(celulas[direita + 1]))
+    ++direita;
+  const int primeira = esquerda - ((celulas[esquerda - 1] & bloqueada) == 0 ? 1 : 0);
+  const int ultima = direita + ((celulas[direita + 1] & bloqueada) == 0 ? 1 : 0);
+
+  // a faixa inteira é revelada de uma vez: os bits num laço e os offsets,
+  // consecutivos, acrescentados em bloco em vez de um push_back por célula
+  for(int q = primeira; q <= ultima; ++q) celulas[q] |= cell::revealedBit;
+  const auto fim{m_reveladas.size()};
+  m_reveladas.resize(fim + static_cast<std::size_t>(ultima - primeira + 1));
+  int *saida = m_reveladas.data() + fim;
+  for(int q = primeira; q <= ultima; ++q) *saida++ = q - ajuste;
+
+  // nas linhas de cima e de baixo, revelar os números que tocam a faixa
+  // (inclusive diagonais) e semear uma única vez cada faixa de zeros oculta
+  for(const int sentido : {-1, 1})
+  {
+    const int deslocamento = sentido * m_stride;
+    const int ajusteVizinha = ajuste + 2 * sentido;
+    bool emFaixa = false;
+    for(int v = esquerda - 1 + deslocamento; v <= direita + 1 + deslocamento; ++v)
+    {
+      if((celulas[v] & bloqueada) != 0)
+      {
+        emFaixa = false;
+      }
+      else if(cell::isZero(celulas[v]))
+      {
+        if(!emFaixa) m_fronteira.push_back(v);
+        emFaixa = true;
+      }
+      else
+      {
+        revelarAqui(v, ajusteVizinha);
+        emFaixa = false;
+      }
+    }
+  }
+  m_reveladasSeguras += static_cast<int>(m_reveladas.size() - antes);
+}
+
+void Board::packBits(Cell bit, std::uint8_t *out) const {
+  // 8 células por vez; cada linha continua no bit seguinte ao da anterior,
+  // sem alinhamento
+  const int deslocamento = std::countr_zero(static_cast<unsigned>(bit));
+  std::memset(out, 0, bitmapBytes());
+  std::size_t posicao = 0;
+  for(int i = 0; i < m_height; ++i)
+  {
+    const Cell *linha = row(i);
+    int j = 0;
+    for(; j + 8 <= m_width; j += 8, posicao += 8)
+    {
+      std::uint64_t palavra{};
+      std::memcpy(&palavra, linha + j, sizeof(palavra));
+      escreverBits(out, posicao, juntar(palavra, deslocamento), 8);
+    }
+    for(; j < m_width; ++j, ++posicao)
+      escreverBits(out, posicao, (linha[j] >> deslocamento) & 1U, 1);
+  }
+}
+
+void Board::unpack(int width, int height, const std::uint8_t *mines, const std::uint8_t *revealed,
+                   const std::uint8_t *flags) {
+  reset(width, height, 0);
+
+  // os três bitmaps numa única passada, 8 células por vez. Uma célula
+  // revelada não pode ter bandeira (o jogo nunca grava isso, mas o arquivo
+  // pode estar corrompido): a bandeira é descartada, aqui e na contagem
+  const int bomba = std::countr_zero(static_cast<unsigned>(cell::mineBit));
+  const int revelada = std::countr_zero(static_cast<unsigned>(cell::revealedBit));
+  const int bandeira = std::countr_zero(static_cast<unsigned>(cell::flagBit));
+  auto carregar = [&](Cell *destino, std::size_t posicao, int quantos) {
+    const auto reveladas{lerBits(revealed, posicao, quantos)};
+    const auto palavra{(espalhar(lerBits(mines, posicao, quantos)) << bomba) |
+                       (espalhar(reveladas) << revelada) |
+                       (espalhar(lerBits(flags, posicao, quantos) & ~reveladas) << bandeira)};
+    std::memcpy(destino, &palavra, static_cast<std::size_t>(quantos));
+  };
+  std::size_t posicao = 0;
+  for(int i = 0; i < m_height; ++i)
+  {
+    Cell *linha = &m_cells[index(i, 0)];
+    int j = 0;
+    for(; j + 8 <= m_width; j += 8, posicao += 8) carregar(linha + j, posicao, 8);
+    if(j < m_width)
+    {
+      carregar(linha + j, posicao, m_width - j);
+      posicao += static_cast<std::size_t>(m_width - j);
+    }
+  }
+
+  // contadores pela contagem de bits dos bitmaps, 64 células por vez; os bits
+  // depois da última célula são ignorados
+  const auto total{static_cast<std::size_t>(size())};
+  int bombasReveladas = 0;
+  for(std::size_t bit = 0; bit < total; bit += 64)
+  {
+    const auto bytes{std::min<std::size_t>(8, bitmapBytes() - bit / 8)};
+    std::uint64_t b{}, r{}, f{};
+    std::memcpy(&b, mines + bit / 8, bytes);
+    std::memcpy(&r, revealed + bit / 8, bytes);
+    std::memcpy(&f, flags + bit / 8, bytes);
+    const auto validas{total - bit >= 64 ? ~std::uint64_t{} : (std::uint64_t{1} << (total - bit)) - 1};
+    b &= validas;
+    r &= validas;
+    f &= validas & ~r;
+    m_mines += std::popcount(b);
+    m_reveladasSeguras += std::popcount(r & ~b);
+    m_bandeiras += std::popcount(f);
+    bombasReveladas += std::popcount(r & b);
+  }
+  m_explodiu = bombasReveladas > 0;
+
+  countNeighbors(&m_cells[index(0, 0)], m_width, m_height, m_stride);
+}
@@ -0,0 +1,119 @@
+#ifndef BOARD_HPP_
+#define BOARD_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "cell.hpp"
+#include "splitmix.hpp"
+
+// Motor do tabuleiro do campo minado, com dimensões definidas em tempo de
+// execução. O armazenamento é contíguo e só é realocado em reset(), nunca
+// durante uma partida.
+//
+// Internamente o tabuleiro tem uma moldura de uma célula de sentinelas
+// (cell::borderBit | cell::revealedBit), então os 8 vizinhos de qualquer
+// célula interna estão sempre a um deslocamento fixo, sem testes de limite.
+// A interface pública usa apenas as coordenadas sem moldura:
+// offset = linha * width() + coluna.
+class Board {
+ public:
+  Board() = default;
+  Board(int width, int height, int mines);
+
+  void reset(int width, int height, int mines); // redimensiona e limpa
+  void clear(); // limpa o tabuleiro mantendo as dimensões
+
+  [[nodiscard]] int width() const { return m_width; }
+  [[nodiscard]] int height() const { return m_height; }
+  [[nodiscard]] int mines() const { return m_mines; }
+  [[nodiscard]] int size() const { return m_width * m_height; }
+
+  // estado da célula no formato compacto (ver cell.hpp)
+  [[nodiscard]] Cell cellAt(int offset) const { return m_cells[index(offset)]; }
+  [[nodiscard]] Cell cellAt(int i, int j) const { return m_cells[index(i, j)]; }
+  [[nodiscard]] int count(int offset) const { return cell::count(cellAt(offset)); }
+  [[nodiscard]] bool isMine(int offset) const { return cell::isMine(cellAt(offset)); }
+  [[nodiscard]] bool isRevealed(int offset) const { return cell::isRevealed(cellAt(offset)); }
+  [[nodiscard]] bool isFlagged(int offset) const { return cell::isFlagged(cellAt(offset)); }
+  // primeira célula da linha i; as células da linha são contíguas. Vale também
+  // para i = -1 e i = height() (linhas da moldura), e row(i)[-1] e
+  // row(i)[width()] são as sentinelas das laterais
+  [[nodiscard]] const Cell* row(int i) const { return &m_cells[index(i, 0)]; }
+
+  // contadores mantidos incrementalmente: checar o fim de jogo custa O(1)
+  [[nodiscard]] int revealedSafe() const { return m_reveladasSeguras; }
+  [[nodiscard]] int flags() const { return m_bandeiras; }
+  [[nodiscard]] bool exploded() const { return m_explodiu; } //alguma bomba foi revelada
+  [[nodiscard]] bool cleared() const { return m_reveladasSeguras == size() - m_mines; } //todas as células seguras reveladas
+
+  // cria as bombas em posições uniformemente aleatórias, fora da zona segura
+  // (células a até safeRadius de distância da clicada). A mesma semente gera
+  // sempre o mesmo tabuleiro. Se a zona segura não deixar espaço para todas
+  // as bombas, o número de bombas é reduzido.
+  void fill(int clicada, std::uint64_t seed, int safeRadius = 0);
+  // como fill acima, mas sorteia com o gerador do chamador, que continua o
+  // mesmo fluxo depois: sem semear um std::mt19937_64 por tabuleiro. Gera
+  // tabuleiros diferentes dos de fill(clicada, seed), que é o que os
+  // replays recriam
+  void fill(int clicada, SplitMix64& engine, int safeRadius = 0);
+  // revela a célula e, se for zero, toda a região conectada de zeros e sua borda.
+  // Retorna as células reveladas nesta chamada (válido até a próxima revelação).
+  const std::vector<int>& reveal(int offset) { return revealBatch({&offset, 1}); }
+  // revela várias células de uma vez: os preenchimentos de todas correm numa
+  // única passada, com uma fila só, e o retorno é um único conjunto de
+  // mudanças (cada célula aparece uma vez)
+  const std::vector<int>& revealBatch(std::span<const int> offsets);
+  // acorde: se a célula é um número revelado com exatamente esse número de
+  // bandeiras em volta, revela de uma vez todas as vizinhas ocultas sem
+  // bandeira (com seus preenchimentos). Retorna as células reveladas, como
+  // revealBatch; vazio se o acorde não se aplica
+  const std::vector<int>& chord(int offset);
+  void revealAll(); //revela todo o tabuleiro (fim de jogo), sem alterar os contadores
+  bool toggleFlag(int offset); //põe ou tira a bandeira de uma célula oculta; retorna se mudou
+  // marca como revelada (ou oculta) cada célula de [offset, offset + count),
+  // sem preenchimento, mantendo os contadores; usado por desfazer/refazer
+  // (ver history.hpp) para repetir exatamente o que uma revelação mudou
+  void setRevealed(int offset, int count, bool revealed);
+
+  // bitmaps de 1 bit por célula, na ordem dos offsets (célula 0 no bit 0 do
+  // primeiro byte), usados para salvar e carregar partidas (ver boardfile.hpp)
+  [[nodiscard]] std::size_t bitmapBytes() const { return (static_cast<std::size_t>(size()) + 7) / 8; }
+  void packBits(Cell bit, std::uint8_t* out) const; //escreve bitmapBytes() bytes com o bit dado de cada célula
+  // recria o tabuleiro a partir dos bitmaps de bombas, reveladas e bandeiras
+  // (bitmapBytes() bytes cada), recalculando as contagens e os contadores.
+  // Bandeiras em células reveladas são descartadas
+  void unpack(int width, int height, const std::uint8_t* mines, const std::uint8_t* revealed,
+              const std::uint8_t* flags);
+
+ private:
+  int m_width{};
+  int m_height{};
+  int m_mines{};
+
+  int m_stride{}; // largura com moldura: distância entre duas linhas em m_cells
+  std::vector<Cell> m_cells; // um byte por célula, (width + 2) x (height + 2) com a moldura
+
+  int m_reveladasSeguras{}; // células sem bomba já reveladas
+  int m_bandeiras{}; // células marcadas com bandeira
+  bool m_explodiu{}; // true se uma bomba foi revelada
+
+  // buffers do preenchimento: mantêm a capacidade entre revelações
+  std::vector<int> m_fronteira; // fila de zeros cujas linhas vizinhas faltam varrer (índices com moldura)
+  std::vector<int> m_reveladas; // células reveladas na última chamada de reveal (offsets sem moldura)
+  std::vector<int> m_candidatas; // índices embaralhados parcialmente em fill (com moldura)
+
+  // conversão de coordenadas sem moldura para índices em m_cells
+  [[nodiscard]] int index(int i, int j) const { return (i + 1) * m_stride + j + 1; }
+  [[nodiscard]] int index(int offset) const { return index(offset / m_width, offset % m_width); }
+
+  template <class Engine>
+  void sortearBombas(int clicada, int safeRadius, Engine& engine); //corpo comum dos dois fill
+  void revelar(int p, int ajuste); //marca a célula como revelada e registra o offset p - ajuste
+  void semear(int p); //revela um número, ou põe um zero na fila do preenchimento
+  void preencher(); //esvazia m_fronteira, varrendo cada faixa de zeros
+  void varrer_linha(int p); //revela a faixa de zeros na linha de p e semeia as linhas vizinhas
+};
+
+#endif
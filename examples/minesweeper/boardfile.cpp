@@ -0,0 +1,139 @@
+#include "boardfile.hpp"
+
+#include <array>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+#define BOARDFILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr std::array<char, 8> assinatura{'M', 'I', 'N', 'E', 'S', 'W', 'P', 'R'};
+constexpr std::size_t tamanhoCabecalho{64};
+constexpr std::size_t cabecalhoMinimo{48}; // campos da versão 1
+
+void escrever32(std::uint8_t *p, std::uint32_t v) {
+  for(int k = 0; k < 4; ++k) p[k] = static_cast<std::uint8_t>(v >> (8 * k));
+}
+void escrever64(std::uint8_t *p, std::uint64_t v) {
+  for(int k = 0; k < 8; ++k) p[k] = static_cast<std::uint8_t>(v >> (8 * k));
+}
+std::uint32_t ler32(const std::uint8_t *p) {
+  std::uint32_t v{};
+  for(int k = 0; k < 4; ++k) v |= static_cast<std::uint32_t>(p[k]) << (8 * k);
+  return v;
+}
+std::uint64_t ler64(const std::uint8_t *p) {
+  std::uint64_t v{};
+  for(int k = 0; k < 8; ++k) v |= static_cast<std::uint64_t>(p[k]) << (8 * k);
+  return v;
+}
+
+// tamanho de um bitmap no arquivo: cada um começa alinhado a 8 bytes
+std::size_t bytesPorBitmap(const Board &board) { return (board.bitmapBytes() + 7) & ~std::size_t{7}; }
+
+[[noreturn]] void falhar(const std::string &path, const char *motivo) {
+  throw std::runtime_error{path + ": " + motivo};
+}
+
+// valida o arquivo inteiro (mapeado ou lido) e recria o tabuleiro a partir dele
+std::uint64_t decodificar(const std::uint8_t *dados, std::size_t tamanho, Board &board,
+                          const std::string &path) {
+  if(tamanho < cabecalhoMinimo || std::memcmp(dados, assinatura.data(), assinatura.size()) != 0)
+    falhar(path, "nao e um arquivo de tabuleiro");
+  const auto versao{ler32(dados + 8)};
+  if(versao == 0 || versao > boardFileVersion) falhar(path, "versao de formato nao suportada");
+
+  const std::size_t cabecalho{ler32(dados + 12)};
+  const auto largura{ler32(dados + 16)};
+  const auto altura{ler32(dados + 20)};
+  const auto bombas{ler32(dados + 24)};
+  const auto semente{ler64(dados + 32)};
+  const auto bytes{ler64(dados + 40)};
+
+  // o tabuleiro com moldura precisa caber nos índices int de Board
+  const auto celulasComMoldura{(static_cast<std::uint64_t>(largura) + 2) * (static_cast<std::uint64_t>(altura) + 2)};
+  const auto celulas{static_cast<std::uint64_t>(largura) * altura};
+  if(largura == 0 || altura == 0 || celulasComMoldura > INT_MAX || bombas > celulas)
+    falhar(path, "dimensoes invalidas");
+  if(cabecalho < cabecalhoMinimo || cabecalho > tamanho || bytes < (celulas + 7) / 8 ||
+     (tamanho - cabecalho) / 3 < bytes)
+    falhar(path, "arquivo truncado");
+
+  const auto *bitmaps{dados + cabecalho};
+  board.unpack(static_cast<int>(largura), static_cast<int>(altura), bitmaps, bitmaps + bytes,
+               bitmaps + 2 * bytes);
+  if(static_cast<std::uint32_t>(board.mines()) != bombas) falhar(path, "numero de bombas nao confere");
+  return semente;
+}
+}  // namespace
+
+void saveBoard(const std::string &path, const Board &board, std::uint64_t seed) {
+  const auto bytes{bytesPorBitmap(board)};
+  std::array<std::uint8_t, tamanhoCabecalho> cabecalho{};
+  std::memcpy(cabecalho.data(), assinatura.data(), assinatura.size());
+  escrever32(&cabecalho[8], boardFileVersion);
+  escrever32(&cabecalho[12], tamanhoCabecalho);
+  escrever32(&cabecalho[16], static_cast<std::uint32_t>(board.width()));
+  escrever32(&cabecalho[20], static_cast<std::uint32_t>(board.height()));
+  escrever32(&cabecalho[24], static_cast<std::uint32_t>(board.mines()));
+  escrever64(&cabecalho[32], seed);
+  escrever64(&cabecalho[40], bytes);
+
+  std::ofstream arquivo{path, std::ios::binary | std::ios::trunc};
+  if(!arquivo) falhar(path, "nao foi possivel criar o arquivo");
+  arquivo.write(reinterpret_cast<const char *>(cabecalho.data()), cabecalho.size());
+
+  // um bitmap por vez no mesmo buffer; o preenchimento até o múltiplo de 8
+  // fica zerado
+  std::vector<std::uint8_t> bitmap(bytes, 0);
+  for(const Cell bit : {cell::mineBit, cell::revealedBit, cell::flagBit})
+  {
+    board.packBits(bit, bitmap.data());
+    arquivo.write(reinterpret_cast<const char *>(bitmap.data()), static_cast<std::streamsize>(bytes));
+  }
+  arquivo.close();
+  if(!arquivo) falhar(path, "erro ao gravar o arquivo");
+}
+
+std::uint64_t loadBoard(const std::string &path, Board &board) {
+#ifdef BOARDFILE_MMAP
+  // os bitmaps são lidos direto das páginas mapeadas, sem copiar o arquivo
+  const int descritor = ::open(path.c_str(), O_RDONLY);
+  if(descritor < 0) falhar(path, "nao foi possivel abrir o arquivo");
+  struct stat info{};
+  if(::fstat(descritor, &info) != 0 || info.st_size <= 0)
+  {
+    ::close(descritor);
+    falhar(path, "arquivo vazio");
+  }
+  const auto tamanho{static_cast<std::size_t>(info.st_size)};
+  void *mapa = ::mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, descritor, 0);
+  ::close(descritor); //o mapeamento continua válido
+  if(mapa == MAP_FAILED) falhar(path, "nao foi possivel mapear o arquivo");
+  ::madvise(mapa, tamanho, MADV_SEQUENTIAL);
+
+  struct Mapeamento {
+    void *dados;
+    std::size_t tamanho;
+    ~Mapeamento() { ::munmap(dados, tamanho); }
+  } mapeamento{mapa, tamanho};
+  return decodificar(static_cast<const std::uint8_t *>(mapeamento.dados), tamanho, board, path);
+#else
+  std::ifstream arquivo{path, std::ios::binary | std::ios::ate};
+  if(!arquivo) falhar(path, "nao foi possivel abrir o arquivo");
+  std::vector<std::uint8_t> dados(static_cast<std::size_t>(arquivo.tellg()));
+  arquivo.seekg(0);
+  if(!arquivo.read(reinterpret_cast<char *>(dados.data()), static_cast<std::streamsize>(dados.size())))
+    falhar(path, "erro ao ler o arquivo");
+  return decodificar(dados.data(), dados.size(), board, path);
+#endif
+}
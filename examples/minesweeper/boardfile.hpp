@@ -0,0 +1,39 @@
+#ifndef BOARDFILE_HPP_
+#define BOARDFILE_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include "board.hpp"
+
+// Arquivo binário de uma partida, versionado. Todos os campos são
+// little-endian:
+//   0  char[8]  "MINESWPR"
+//   8  uint32   versão do formato (boardFileVersion)
+//   12 uint32   tamanho do cabeçalho em bytes (os bitmaps começam depois dele)
+//   16 uint32   largura
+//   20 uint32   altura
+//   24 uint32   número de bombas
+//   28 uint32   reservado (0)
+//   32 uint64   semente do tabuleiro
+//   40 uint64   tamanho de cada bitmap em bytes (múltiplo de 8)
+//   48 ...      reservado (0) até o fim do cabeçalho
+// seguido dos bitmaps de bombas, de células reveladas e de bandeiras, um bit
+// por célula (ver Board::packBits). São 3 bits por célula: as contagens de
+// vizinhos não são guardadas e são recalculadas ao carregar.
+//
+// Versões futuras podem acrescentar campos ao cabeçalho sem mudar o começo;
+// arquivos de versão maior que a suportada são recusados.
+//
+// Em builds nativos com POSIX o arquivo é carregado com mmap e os bitmaps
+// são lidos direto do mapeamento, sem cópia intermediária; no WebAssembly
+// (e no Windows) o arquivo é lido com uma leitura comum.
+constexpr std::uint32_t boardFileVersion{1};
+
+// grava o tabuleiro e a semente; lança std::runtime_error se falhar
+void saveBoard(const std::string& path, const Board& board, std::uint64_t seed);
+// carrega o tabuleiro e retorna a semente; lança std::runtime_error se o
+// arquivo não existir, estiver truncado ou tiver formato desconhecido
+std::uint64_t loadBoard(const std::string& path, Board& board);
+
+#endif
@@ -0,0 +1,282 @@
+#include "boardrenderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include <glm/vec2.hpp>
+
+#include "glyphatlas.hpp"
+#include "glyphs.hpp"
+
+namespace {
+// resumo de um bloco para o nível de detalhe: a fração de células reveladas
+// nos bits 0-5, o bit 6 se há alguma bandeira e o 7 se há uma bomba revelada
+std::uint8_t resumoDoBloco(const Cell *inicio, int distancia, int largura, int altura) {
+  int reveladas{};
+  std::uint8_t marcas{};
+  for (auto i{0}; i < altura; ++i) {
+    const auto *linha{inicio + static_cast<std::ptrdiff_t>(i) * distancia};
+    for (auto j{0}; j < largura; ++j) {
+      const auto c{linha[j]};
+      if (!cell::isRevealed(c)) {
+        if (cell::isFlagged(c)) marcas |= 0x40;
+        continue;
+      }
+      ++reveladas;
+      if (cell::isMine(c)) marcas |= 0x80;
+    }
+  }
+  return static_cast<std::uint8_t>(marcas | (reveladas * 63 / (largura * altura)));
+}
+}  // namespace
+
+void BoardTexture::upload(const Board &board) {
+  // a memória do tabuleiro, com a moldura, é enviada de uma vez a partir da
+  // sentinela do canto
+  upload(board.width(), board.height(), board.row(-1) - 1);
+}
+
+void BoardTexture::upload(int width, int height, const Cell *cells) {
+  // textura (largura + 2) x (altura + 2): a moldura vai junto
+  const auto largura{width + 2};
+  const auto altura{height + 2};
+  const auto *dados{cells};
+  abcg::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  if (m_texture == 0) abcg::glGenTextures(1, &m_texture);
+  abcg::glBindTexture(GL_TEXTURE_2D, m_texture);
+  if (width != m_width || height != m_height) {
+    m_width = width;
+    m_height = height;
+    abcg::glTexImage2D(GL_TEXTURE_2D, 0, GL_R8UI, largura, altura, 0, GL_RED_INTEGER,
+                       GL_UNSIGNED_BYTE, dados);
+    // texturas de inteiros não podem ser filtradas
+    abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // a textura de blocos acompanha o tamanho; o conteúdo vem de resumir()
+    m_blocosX = (width + tileSize - 1) / tileSize;
+    m_blocosY = (height + tileSize - 1) / tileSize;
+    m_resumo.assign(static_cast<std::size_t>(m_blocosX) * m_blocosY, 0);
+    if (m_blocos == 0) abcg::glGenTextures(1, &m_blocos);
+    abcg::glBindTexture(GL_TEXTURE_2D, m_blocos);
+    abcg::glTexImage2D(GL_TEXTURE_2D, 0, GL_R8UI, m_blocosX, m_blocosY, 0, GL_RED_INTEGER,
+                       GL_UNSIGNED_BYTE, m_resumo.data());
+    abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  } else {
+    abcg::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, largura, altura, GL_RED_INTEGER,
+                          GL_UNSIGNED_BYTE, dados);
+  }
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+  resumir(cells, 0, 0, m_blocosX, m_blocosY);
+}
+
+void BoardTexture::update(const Board &board, const std::vector<DirtyRegions::Rect> &rects) {
+  if (rects.empty()) return;
+  std::size_t total{};
+  for (const auto &r : rects) total += static_cast<std::size_t>(r.width) * r.height;
+  // se a mudança cobre boa parte do tabuleiro, uma cópia só sai mais barata
+  if (total * 2 > static_cast<std::size_t>(board.size())) {
+    upload(board);
+    return;
+  }
+
+  abcg::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  abcg::glBindTexture(GL_TEXTURE_2D, m_texture);
+  if (m_streaming) {
+    enviarPorBuffer(board, rects, total);
+  } else {
+    // cada retângulo sai direto da memória do tabuleiro: a distância entre
+    // as linhas é a largura com a moldura
+    abcg::glPixelStorei(GL_UNPACK_ROW_LENGTH, board.width() + 2);
+    for (const auto &r : rects)
+      abcg::glTexSubImage2D(GL_TEXTURE_2D, 0, r.x + 1, r.y + 1, r.width, r.height, GL_RED_INTEGER,
+                            GL_UNSIGNED_BYTE, board.row(r.y) + r.x);
+    abcg::glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  }
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+
+  for (const auto &r : rects)
+    resumir(board.row(-1) - 1, r.x / tileSize, r.y / tileSize, (r.x + r.width - 1) / tileSize + 1,
+            (r.y + r.height - 1) / tileSize + 1);
+}
+
+void BoardTexture::resumir(const Cell *cells, int bx0, int by0, int bx1, int by1) {
+  const auto distancia{m_width + 2};
+  for (auto by{by0}; by < by1; ++by) {
+    for (auto bx{bx0}; bx < bx1; ++bx) {
+      const auto x{bx * tileSize};
+      const auto y{by * tileSize};
+      const auto *inicio{cells + static_cast<std::ptrdiff_t>(y + 1) * distancia + x + 1};
+      m_resumo[static_cast<std::size_t>(by) * m_blocosX + bx] = resumoDoBloco(
+          inicio, distancia, std::min(tileSize, m_width - x), std::min(tileSize, m_height - y));
+    }
+  }
+
+  abcg::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  abcg::glPixelStorei(GL_UNPACK_ROW_LENGTH, m_blocosX);
+  abcg::glBindTexture(GL_TEXTURE_2D, m_blocos);
+  abcg::glTexSubImage2D(GL_TEXTURE_2D, 0, bx0, by0, bx1 - bx0, by1 - by0, GL_RED_INTEGER,
+                        GL_UNSIGNED_BYTE, m_resumo.data() + static_cast<std::ptrdiff_t>(by0) * m_blocosX + bx0);
+  abcg::glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void BoardTexture::enviarPorBuffer(const Board &board, const std::vector<DirtyRegions::Rect> &rects,
+                                   std::size_t total) {
+  if (m_buffers[0] == 0) abcg::glGenBuffers(static_cast<GLsizei>(m_buffers.size()), m_buffers.data());
+  const auto k{m_proximo};
+  m_proximo = (m_proximo + 1) % m_buffers.size();
+  abcg::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_buffers[k]);
+  if (m_capacidades[k] < total) {
+    m_capacidades[k] = std::max(total, 2 * m_capacidades[k]);
+    abcg::glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(m_capacidades[k]), nullptr,
+                       GL_STREAM_DRAW);
+  }
+
+  // os retângulos ficam lado a lado no buffer, cada um com as linhas justas
+#if defined(__EMSCRIPTEN__)
+  m_copia.resize(total);
+  auto *destino{m_copia.data()};
+#else
+  auto *destino{static_cast<Cell *>(abcg::glMapBufferRange(
+      GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(total),
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT))};
+#endif
+  for (const auto &r : rects)
+    for (auto i{r.y}; i < r.y + r.height; ++i) destino = std::copy_n(board.row(i) + r.x, r.width, destino);
+#if defined(__EMSCRIPTEN__)
+  abcg::glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(total), m_copia.data());
+#else
+  abcg::glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+#endif
+
+  std::uintptr_t deslocamento{};
+  for (const auto &r : rects) {
+    abcg::glTexSubImage2D(GL_TEXTURE_2D, 0, r.x + 1, r.y + 1, r.width, r.height, GL_RED_INTEGER,
+                          GL_UNSIGNED_BYTE, reinterpret_cast<const void *>(deslocamento));
+    deslocamento += static_cast<std::uintptr_t>(r.width) * r.height;
+  }
+  abcg::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void BoardTexture::destroy() {
+  if (m_buffers[0] != 0) abcg::glDeleteBuffers(static_cast<GLsizei>(m_buffers.size()), m_buffers.data());
+  m_buffers = {};
+  m_capacidades = {};
+  abcg::glDeleteTextures(1, &m_texture);
+  abcg::glDeleteTextures(1, &m_blocos);
+  m_texture = 0;
+  m_blocos = 0;
+  m_width = 0;
+  m_height = 0;
+  m_resumo.clear();
+}
+
+void BoardRenderer::initialize(GLuint program) {
+  m_program = program;
+  m_cellsLoc = abcg::glGetUniformLocation(m_program, "cells");
+  m_boardSizeLoc = abcg::glGetUniformLocation(m_program, "boardSize");
+  m_showAllLoc = abcg::glGetUniformLocation(m_program, "showAll");
+  m_glyphsLoc = abcg::glGetUniformLocation(m_program, "glyphs");
+  m_tilesLoc = abcg::glGetUniformLocation(m_program, "tiles");
+  m_unitLoc = abcg::glGetUniformLocation(m_program, "unit");
+  m_firstUnitLoc = abcg::glGetUniformLocation(m_program, "firstUnit");
+  m_columnsLoc = abcg::glGetUniformLocation(m_program, "columns");
+  m_viewOriginLoc = abcg::glGetUniformLocation(m_program, "viewOrigin");
+  m_viewSpanLoc = abcg::glGetUniformLocation(m_program, "viewSpan");
+
+  // atlas de glifos: a distância é interpolada entre os texels, então o
+  // filtro linear é o que mantém o contorno liso quando ampliado
+  static_assert(GLYPHS_SDF.size() == static_cast<std::size_t>(glyphs::width) * glyphs::height);
+  abcg::glGenTextures(1, &m_glyphs);
+  abcg::glBindTexture(GL_TEXTURE_2D, m_glyphs);
+  abcg::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  abcg::glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, glyphs::width, glyphs::height, 0, GL_RED,
+                     GL_UNSIGNED_BYTE, GLYPHS_SDF.data());
+  abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  abcg::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+
+  // quadrado unitário de uma célula, como GL_TRIANGLE_STRIP
+  const std::array<glm::vec2, 4> cantos{glm::vec2{0, 0}, glm::vec2{1, 0}, glm::vec2{0, 1},
+                                        glm::vec2{1, 1}};
+  abcg::glGenBuffers(1, &m_VBO);
+  abcg::glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+  abcg::glBufferData(GL_ARRAY_BUFFER, sizeof(cantos), cantos.data(), GL_STATIC_DRAW);
+  abcg::glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  const auto positionAttribute{abcg::glGetAttribLocation(m_program, "inPosition")};
+  abcg::glGenVertexArrays(1, &m_VAO);
+  abcg::glBindVertexArray(m_VAO);
+  abcg::glEnableVertexAttribArray(positionAttribute);
+  abcg::glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+  abcg::glVertexAttribPointer(positionAttribute, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+  abcg::glBindBuffer(GL_ARRAY_BUFFER, 0);
+  abcg::glBindVertexArray(0);
+}
+
+void BoardRenderer::terminate() {
+  abcg::glDeleteTextures(1, &m_glyphs);
+  abcg::glDeleteBuffers(1, &m_VBO);
+  abcg::glDeleteVertexArrays(1, &m_VAO);
+}
+
+void BoardRenderer::draw(const BoardTexture &texture, int x, int y, int width, int height,
+                         const BoardView &view, bool showAll) const {
+  if (texture.id() == 0 || width <= 0 || height <= 0) return;
+
+  // janela do tabuleiro, em células, que cabe na região
+  const auto inteiro{view.span <= 0};
+  const auto x0{inteiro ? 0.0f : view.x};
+  const auto y0{inteiro ? 0.0f : view.y};
+  const auto span{inteiro ? static_cast<float>(std::max(texture.width(), texture.height())) : view.span};
+  const glm::vec2 janela{span, span * static_cast<float>(height) / static_cast<float>(width)};
+
+  // de longe cada instância é um bloco; a faixa de unidades (células ou
+  // blocos) visíveis é o que vai para a GPU
+  const auto unidade{static_cast<float>(width) / span < minCellPixels ? BoardTexture::tileSize : 1};
+  const auto faixa{[unidade](float inicio, float tamanho, int limite) {
+    const auto total{(limite + unidade - 1) / unidade};
+    const auto primeira{std::clamp(static_cast<int>(std::floor(inicio / unidade)), 0, total)};
+    const auto ultima{std::clamp(static_cast<int>(std::ceil((inicio + tamanho) / unidade)), primeira, total)};
+    return std::pair{primeira, ultima - primeira};
+  }};
+  const auto [coluna, colunas]{faixa(x0, janela.x, texture.width())};
+  const auto [linha, linhas]{faixa(y0, janela.y, texture.height())};
+  if (colunas == 0 || linhas == 0) return;
+
+  abcg::glViewport(x, y, width, height);
+  abcg::glUseProgram(m_program);
+  abcg::glBindVertexArray(m_VAO);
+  abcg::glActiveTexture(GL_TEXTURE0);
+  abcg::glBindTexture(GL_TEXTURE_2D, texture.id());
+  abcg::glUniform1i(m_cellsLoc, 0);
+  abcg::glUniform2i(m_boardSizeLoc, texture.width(), texture.height());
+  abcg::glUniform1i(m_showAllLoc, showAll ? 1 : 0);
+  abcg::glActiveTexture(GL_TEXTURE1);
+  abcg::glBindTexture(GL_TEXTURE_2D, m_glyphs);
+  abcg::glUniform1i(m_glyphsLoc, 1);
+  abcg::glActiveTexture(GL_TEXTURE2);
+  abcg::glBindTexture(GL_TEXTURE_2D, texture.tiles());
+  abcg::glUniform1i(m_tilesLoc, 2);
+  abcg::glUniform1i(m_unitLoc, unidade);
+  abcg::glUniform2i(m_firstUnitLoc, coluna, linha);
+  abcg::glUniform1i(m_columnsLoc, colunas);
+  abcg::glUniform2f(m_viewOriginLoc, x0, y0);
+  abcg::glUniform2f(m_viewSpanLoc, janela.x, janela.y);
+
+  abcg::glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, colunas * linhas);
+
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+  abcg::glActiveTexture(GL_TEXTURE1);
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+  abcg::glActiveTexture(GL_TEXTURE0);
+  abcg::glBindTexture(GL_TEXTURE_2D, 0);
+  abcg::glBindVertexArray(0);
+  abcg::glUseProgram(0);
+}
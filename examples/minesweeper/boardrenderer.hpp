@@ -0,0 +1,120 @@
+#ifndef BOARDRENDERER_HPP_
+#define BOARDRENDERER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "abcg.hpp"
+#include "board.hpp"
+#include "dirtyregions.hpp"
+
+// Estado de um tabuleiro na GPU: uma textura de inteiros (R8UI) com um texel
+// por célula, no formato de cell.hpp, incluindo a moldura de sentinelas. A
+// memória do Board já tem esse formato, então o envio é uma cópia direta.
+//
+// Depois do primeiro envio, update() manda só os retângulos alterados (ver
+// dirtyregions.hpp). Com streaming ligado os retângulos passam por um anel
+// de pixel buffers: a cópia para a GPU fica assíncrona e o buffer escrito em
+// um quadro não é o que a GPU ainda pode estar lendo do anterior.
+//
+// Junto vai uma segunda textura, bem menor, com um texel por bloco de
+// tileSize x tileSize células: o resumo usado pelo nível de detalhe quando o
+// tabuleiro é visto de longe. Cada envio recalcula só os blocos que tocou.
+class BoardTexture {
+ public:
+  static constexpr int tileSize{16};
+
+  void upload(const Board& board); //envia o tabuleiro inteiro; recria a textura se o tamanho mudou
+  // envia células width x height já com a moldura: (width + 2) x (height + 2)
+  // bytes, linha a linha (usado pela vista do modo infinito)
+  void upload(int width, int height, const Cell* cells);
+  // envia só os retângulos dados (em células, sem moldura); o tamanho do
+  // tabuleiro tem que ser o do último upload()
+  void update(const Board& board, const std::vector<DirtyRegions::Rect>& rects);
+  void setStreaming(bool streaming) { m_streaming = streaming; }
+  void destroy();
+
+  [[nodiscard]] GLuint id() const { return m_texture; }
+  [[nodiscard]] int width() const { return m_width; } //dimensões do tabuleiro, sem a moldura
+  [[nodiscard]] int height() const { return m_height; }
+  [[nodiscard]] GLuint tiles() const { return m_blocos; } //resumo dos blocos (R8UI, sem moldura)
+
+ private:
+  GLuint m_texture{};
+  int m_width{};
+  int m_height{};
+
+  GLuint m_blocos{};
+  int m_blocosX{}; // blocos na largura e na altura (o último pode ser parcial)
+  int m_blocosY{};
+  std::vector<std::uint8_t> m_resumo; // cópia na CPU da textura de blocos
+
+  bool m_streaming{};
+  std::array<GLuint, 2> m_buffers{}; // anel de GL_PIXEL_UNPACK_BUFFER
+  std::array<std::size_t, 2> m_capacidades{};
+  std::size_t m_proximo{}; // próximo buffer do anel
+#if defined(__EMSCRIPTEN__)
+  std::vector<Cell> m_copia; // WebGL 2 não mapeia buffers: os retângulos são juntados aqui
+#endif
+
+  void enviarPorBuffer(const Board& board, const std::vector<DirtyRegions::Rect>& rects,
+                       std::size_t total);
+  // recalcula os blocos [bx0, bx1) x [by0, by1) a partir das células com
+  // moldura e envia esse retângulo da textura de blocos
+  void resumir(const Cell* cells, int bx0, int by0, int bx1, int by1);
+};
+
+// Parte de um tabuleiro mostrada numa região: (x, y) é a posição, em células,
+// do canto superior esquerdo da região e span quantas células cabem na
+// largura dela. span <= 0 mostra o tabuleiro inteiro.
+struct BoardView {
+  float x{};
+  float y{};
+  float span{};
+};
+
+// Desenho de tabuleiros com o programa de objects.vert/objects.frag: as
+// células de um tabuleiro saem de uma única chamada instanciada (uma
+// instância por célula, o estado lido da BoardTexture no vertex shader), então
+// o custo de CPU por quadro não depende do tamanho do tabuleiro. Só as
+// células dentro da BoardView viram instâncias, e quando uma célula fica com
+// menos de minCellPixels pixels cada instância passa a ser um bloco inteiro,
+// pintado pelo resumo: o custo na GPU segue o que aparece na tela, não o
+// tamanho do tabuleiro. O mesmo renderizador desenha qualquer número de
+// tabuleiros, cada um na sua região.
+//
+// Números, bandeiras e bombas vêm do atlas de SDFs de glyphs.hpp, embutido
+// no executável e amostrado no fragment shader: os rótulos ficam nítidos em
+// qualquer tamanho de célula sem nenhum custo de CPU.
+class BoardRenderer {
+ public:
+  static constexpr float minCellPixels{3.0f};
+
+  void initialize(GLuint program);
+  void terminate();
+
+  // desenha o tabuleiro no retângulo (x, y, width, height) do framebuffer, em
+  // pixels com a origem no canto inferior esquerdo, enquadrado por view;
+  // showAll mostra bombas e números ocultos (fim de jogo)
+  void draw(const BoardTexture& texture, int x, int y, int width, int height, const BoardView& view,
+            bool showAll) const;
+
+ private:
+  GLuint m_program{};
+  GLuint m_VAO{};
+  GLuint m_VBO{};
+  GLint m_cellsLoc{};
+  GLint m_boardSizeLoc{};
+  GLint m_showAllLoc{};
+  GLint m_glyphsLoc{};
+  GLint m_tilesLoc{};
+  GLint m_unitLoc{};
+  GLint m_firstUnitLoc{};
+  GLint m_columnsLoc{};
+  GLint m_viewOriginLoc{};
+  GLint m_viewSpanLoc{};
+  GLuint m_glyphs{}; // textura do atlas de glifos
+};
+
+#endif
@@ -0,0 +1,35 @@
+#include "bot.hpp"
+
+void Bot::start(const Board &board, int clicada) {
+  m_board = board;
+  m_primeira = clicada;
+  m_jogadas = 0;
+  m_chutes = 0;
+  m_ultima = &m_nenhuma;
+}
+
+const std::vector<int> &Bot::step() {
+  m_ultima = &m_nenhuma;
+  if(over() || m_board.size() == 0) return m_nenhuma;
+  if(m_primeira >= 0)
+  {
+    m_ultima = &m_board.reveal(m_primeira);
+    m_primeira = -1;
+    ++m_jogadas;
+    m_solver.reset(m_board);
+    return *m_ultima;
+  }
+
+  int offset = m_solver.nextSafe(m_board);
+  if(offset < 0)
+  {
+    m_probabilidade.compute(m_board, m_solver);
+    offset = m_probabilidade.bestGuess(m_board);
+    if(offset < 0) return m_nenhuma;
+    ++m_chutes;
+  }
+  ++m_jogadas;
+  m_ultima = &m_board.reveal(offset);
+  m_solver.update(m_board, *m_ultima);
+  return *m_ultima;
+}
@@ -0,0 +1,39 @@
+#ifndef BOT_HPP_
+#define BOT_HPP_
+
+#include <vector>
+
+#include "board.hpp"
+#include "probability.hpp"
+#include "solver.hpp"
+
+// Adversário do modo torneio: joga sozinho uma cópia do tabuleiro do jogador
+// com a estratégia gulosa do simulador (a próxima célula que o solver provou
+// ser segura ou, se não houver, a de menor probabilidade de bomba). Cada
+// jogada é independente do resto do jogo e pode rodar em qualquer thread,
+// desde que uma de cada vez.
+class Bot {
+ public:
+  // copia um tabuleiro já preenchido; a primeira jogada é o clique em clicada
+  void start(const Board& board, int clicada);
+  // uma jogada; retorna as células reveladas (válido até a próxima jogada)
+  const std::vector<int>& step();
+  [[nodiscard]] const std::vector<int>& lastStep() const { return *m_ultima; } //o retorno do último step()
+
+  [[nodiscard]] const Board& board() const { return m_board; }
+  [[nodiscard]] bool over() const { return m_board.exploded() || m_board.cleared(); }
+  [[nodiscard]] int moves() const { return m_jogadas; }
+  [[nodiscard]] int guesses() const { return m_chutes; }
+
+ private:
+  Board m_board;
+  Solver m_solver;
+  Probability m_probabilidade;
+  int m_primeira{-1}; // clique inicial ainda não feito
+  int m_jogadas{};
+  int m_chutes{};
+  std::vector<int> m_nenhuma; // retorno de step() quando não há jogada
+  const std::vector<int>* m_ultima{&m_nenhuma};
+};
+
+#endif
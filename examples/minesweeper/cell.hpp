@@ -0,0 +1,36 @@
+#ifndef CELL_HPP_
+#define CELL_HPP_
+
+#include <cstdint>
+
+// Formato compacto de uma célula do tabuleiro em um único byte, compartilhado
+// pelo jogo, pelo renderizador e pelo solver:
+//   bits 0-3: número de bombas vizinhas (0-8)
+//   bit 4: bomba
+//   bit 5: revelada
+//   bit 6: bandeira
+//   bit 7: borda (sentinela fora do tabuleiro, sempre "revelada")
+using Cell = std::uint8_t;
+
+namespace cell {
+constexpr Cell countMask{0x0F};
+constexpr Cell mineBit{0x10};
+constexpr Cell revealedBit{0x20};
+constexpr Cell flagBit{0x40};
+constexpr Cell borderBit{0x80};
+
+[[nodiscard]] constexpr int count(Cell c) { return c & countMask; }
+[[nodiscard]] constexpr bool isMine(Cell c) { return (c & mineBit) != 0; }
+[[nodiscard]] constexpr bool isRevealed(Cell c) { return (c & revealedBit) != 0; }
+[[nodiscard]] constexpr bool isFlagged(Cell c) { return (c & flagBit) != 0; }
+// célula sem bomba e sem bombas vizinhas (dispara o preenchimento)
+[[nodiscard]] constexpr bool isZero(Cell c) { return (c & (countMask | mineBit)) == 0; }
+
+// repete o mesmo byte nas 8 posições de uma palavra de 64 bits, para operar
+// sobre o tabuleiro inteiro 8 células por vez
+[[nodiscard]] constexpr std::uint64_t broadcast(Cell c) {
+  return UINT64_C(0x0101010101010101) * c;
+}
+}  // namespace cell
+
+#endif
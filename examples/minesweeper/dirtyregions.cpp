@@ -0,0 +1,65 @@
+#include "dirtyregions.hpp"
+
+#include <algorithm>
+
+void DirtyRegions::reset(int width, int height) {
+  m_width = width;
+  m_height = height;
+  m_blocosX = (width + tileSize - 1) >> tileShift;
+  const auto blocosY{(height + tileSize - 1) >> tileShift};
+  m_caixas.assign(static_cast<std::size_t>(m_blocosX) * blocosY, Caixa{});
+  m_tocados.clear();
+}
+
+void DirtyRegions::mark(int offset) {
+  const auto y{offset / m_width};
+  const auto x{offset - y * m_width};
+  const auto bloco{(y >> tileShift) * m_blocosX + (x >> tileShift)};
+  const auto lx{static_cast<std::uint8_t>(x & (tileSize - 1))};
+  const auto ly{static_cast<std::uint8_t>(y & (tileSize - 1))};
+  auto &caixa{m_caixas[bloco]};
+  if(caixa.x0 > caixa.x1)
+  {
+    caixa = {lx, ly, lx, ly};
+    m_tocados.push_back(bloco);
+    return;
+  }
+  caixa.x0 = std::min(caixa.x0, lx);
+  caixa.x1 = std::max(caixa.x1, lx);
+  caixa.y0 = std::min(caixa.y0, ly);
+  caixa.y1 = std::max(caixa.y1, ly);
+}
+
+const std::vector<DirtyRegions::Rect> &DirtyRegions::take() {
+  m_retangulos.clear();
+  std::sort(m_tocados.begin(), m_tocados.end());
+
+  // blocos consecutivos da mesma faixa são unidos: a caixa da união pode
+  // incluir células não marcadas, mas nunca sai da faixa de tileSize linhas
+  int anterior = -2;
+  for(const auto bloco : m_tocados)
+  {
+    auto &caixa{m_caixas[bloco]};
+    const auto bx{(bloco % m_blocosX) << tileShift};
+    const auto by{(bloco / m_blocosX) << tileShift};
+    const Rect r{bx + caixa.x0, by + caixa.y0, caixa.x1 - caixa.x0 + 1, caixa.y1 - caixa.y0 + 1};
+    caixa = Caixa{};
+
+    if(bloco == anterior + 1 && bloco % m_blocosX != 0)
+    {
+      auto &u{m_retangulos.back()};
+      const auto y0{std::min(u.y, r.y)};
+      const auto y1{std::max(u.y + u.height, r.y + r.height)};
+      u.width = r.x + r.width - u.x;
+      u.y = y0;
+      u.height = y1 - y0;
+    }
+    else
+    {
+      m_retangulos.push_back(r);
+    }
+    anterior = bloco;
+  }
+  m_tocados.clear();
+  return m_retangulos;
+}
@@ -0,0 +1,54 @@
+#ifndef DIRTYREGIONS_HPP_
+#define DIRTYREGIONS_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Células alteradas desde o último envio do tabuleiro à GPU, agrupadas em
+// retângulos para glTexSubImage2D. O tabuleiro é dividido em blocos de
+// tileSize x tileSize; cada bloco guarda a caixa que envolve as suas células
+// marcadas, e blocos vizinhos na mesma faixa de blocos viram um retângulo só.
+// Um clique que revela poucas células envia poucos bytes, e um preenchimento
+// grande envia só as faixas que tocou, nunca o tabuleiro inteiro.
+//
+// Marcar custa O(1) por célula e take() custa O(blocos tocados).
+class DirtyRegions {
+ public:
+  static constexpr int tileShift{6};
+  static constexpr int tileSize{1 << tileShift};
+
+  struct Rect {
+    int x{}; // coluna
+    int y{}; // linha
+    int width{};
+    int height{};
+  };
+
+  void reset(int width, int height); //dimensões do tabuleiro (sem moldura); nada marcado
+  void mark(int offset); //offset sem moldura, como em Board
+  void mark(std::span<const int> offsets) {
+    for(const auto offset : offsets) mark(offset);
+  }
+
+  [[nodiscard]] bool empty() const { return m_tocados.empty(); }
+  // retângulos que cobrem todas as células marcadas, em ordem de linhas; o
+  // estado volta a vazio (o retorno vale até a próxima chamada)
+  [[nodiscard]] const std::vector<Rect>& take();
+
+ private:
+  // caixa das células marcadas de um bloco, em coordenadas do bloco; vazia
+  // quando x0 > x1
+  struct Caixa {
+    std::uint8_t x0{1}, y0{}, x1{}, y1{};
+  };
+
+  int m_width{};
+  int m_height{};
+  int m_blocosX{}; // blocos por faixa
+  std::vector<Caixa> m_caixas;
+  std::vector<int> m_tocados; // blocos com alguma célula marcada, na ordem em que foram tocados
+  std::vector<Rect> m_retangulos;
+};
+
+#endif
@@ -1,14 +1,17 @@
-#ifndef GAMEDATA_HPP_
-#define GAMEDATA_HPP_
-
-#include <bitset>
-
-enum class Input { Right, Left };
-enum class GameState { Start, Play, Won, Lost };
-
-struct GameData {
-  GameState m_gameState{GameState::Start};
-  std::bitset<2> m_input;  // [left, right]
-};
-
+#ifndef GAMEDATA_HPP_
+#define GAMEDATA_HPP_
+
+#include <bitset>
+
+enum class Input { Right, Left };
+enum class GameState { Start, Play, Won, Lost };
+// ação do mouse sobre uma célula: o esquerdo revela, o direito põe ou tira a
+// bandeira, e os dois juntos ou o do meio fazem o acorde
+enum class Acao { Nenhuma, Revelar, Bandeira, Acorde };
+
+struct GameData {
+  GameState m_gameState{GameState::Start};
+  std::bitset<2> m_input;  // [left, right]
+};
+
 #endif
\ No newline at end of file
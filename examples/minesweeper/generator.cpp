@@ -0,0 +1,121 @@
+#include "generator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "solver.hpp"
+
+namespace {
+// semente do candidato k: a própria seed para k = 0 e, para os demais, uma
+// mistura splitmix64 de (seed, k), para que candidatos vizinhos não gerem
+// sequências correlacionadas no mt19937_64
+std::uint64_t sementeCandidato(std::uint64_t seed, int k) {
+  if(k == 0) return seed;
+  std::uint64_t z = seed + static_cast<std::uint64_t>(k) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// true se o solver ganha o tabuleiro (já preenchido) sem chutar
+bool resolvivel(Board &board, Solver &solver, int clicada) {
+  board.reveal(clicada);
+  solver.reset(board);
+  for(int segura = solver.nextSafe(board); segura >= 0; segura = solver.nextSafe(board))
+    solver.update(board, board.reveal(segura));
+  return board.cleared();
+}
+
+unsigned numeroDeThreads(unsigned pedidas) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  // WebAssembly sem pthreads: tudo na thread principal
+  static_cast<void>(pedidas);
+  return 1;
+#else
+  if(pedidas == 0) pedidas = std::thread::hardware_concurrency();
+  return std::max(pedidas, 1U);
+#endif
+}
+}  // namespace
+
+NoGuessResult fillNoGuess(Board &board, int clicada, std::uint64_t seed, int safeRadius,
+                          int maxCandidates, unsigned threads, const NoGuessExecutor &executor) {
+  // estado compartilhado com as auxiliares: com um executor, uma tarefa pode
+  // começar depois que a busca terminou e esta função retornou
+  struct Busca {
+    Board base;
+    std::atomic<int> proximo{0};
+    std::atomic<int> vencedor;
+    std::atomic<int> testados{0};
+    std::mutex mutex;
+    std::condition_variable terminou;
+    int ativas{}; // auxiliares avaliando candidatos
+    bool encerrada{}; // quem chamou terminou: auxiliares que ainda não começaram não começam mais
+  };
+  auto busca{std::make_shared<Busca>()};
+  busca->base = board;
+  busca->vencedor = maxCandidates;
+
+  // cada thread pega o próximo índice livre; quando um candidato serve, os
+  // índices maiores que ele deixam de ser avaliados, mas os menores ainda em
+  // andamento terminam e podem tomar o seu lugar
+  auto trabalhar = [clicada, seed, safeRadius](Busca &b) {
+    Board candidato{b.base};
+    Solver solver;
+    for(int k = b.proximo.fetch_add(1); k < b.vencedor.load(); k = b.proximo.fetch_add(1))
+    {
+      candidato.clear();
+      candidato.fill(clicada, sementeCandidato(seed, k), safeRadius);
+      b.testados.fetch_add(1, std::memory_order_relaxed);
+      if(!resolvivel(candidato, solver, clicada)) continue;
+
+      int atual = b.vencedor.load();
+      while(k < atual && !b.vencedor.compare_exchange_weak(atual, k)) {}
+    }
+  };
+  auto auxiliar = [busca, trabalhar] {
+    {
+      const std::scoped_lock trava{busca->mutex};
+      if(busca->encerrada) return;
+      ++busca->ativas;
+    }
+    trabalhar(*busca);
+    {
+      const std::scoped_lock trava{busca->mutex};
+      --busca->ativas;
+    }
+    busca->terminou.notify_all();
+  };
+
+  const auto total{std::min(numeroDeThreads(threads),
+                            static_cast<unsigned>(std::max(maxCandidates, 1)))};
+  std::vector<std::thread> proprias;
+  if(!executor) proprias.reserve(total - 1);
+  for(unsigned t = 1; t < total; ++t)
+  {
+    if(executor) executor(auxiliar);
+    else proprias.emplace_back(auxiliar);
+  }
+  trabalhar(*busca); //a thread que chamou também trabalha
+
+  // todo índice menor que o vencedor foi pego por alguém: espera só as
+  // auxiliares que ainda estão avaliando o seu
+  {
+    std::unique_lock trava{busca->mutex};
+    busca->encerrada = true;
+    busca->terminou.wait(trava, [&] { return busca->ativas == 0; });
+  }
+  for(auto &propria : proprias) propria.join();
+
+  // refaz o vencedor no tabuleiro do chamador: o preenchimento é barato e
+  // determinístico, então não vale copiar o tabuleiro entre threads
+  NoGuessResult resultado{busca->vencedor.load(), busca->testados.load()};
+  if(resultado.candidate == maxCandidates) resultado.candidate = -1;
+  board.fill(clicada, sementeCandidato(seed, std::max(resultado.candidate, 0)), safeRadius);
+  return resultado;
+}
@@ -0,0 +1,39 @@
+#ifndef GENERATOR_HPP_
+#define GENERATOR_HPP_
+
+#include <cstdint>
+#include <functional>
+
+#include "board.hpp"
+
+// Resultado da geração sem chute
+struct NoGuessResult {
+  int candidate{-1}; // índice do candidato escolhido, ou -1 se nenhum dispensou chute
+  int tested{}; // candidatos avaliados, somando todas as threads
+};
+
+// Geração "sem chute": sorteia tabuleiros candidatos e fica com o primeiro
+// que o Solver termina a partir do clique inicial sem precisar chutar.
+//
+// O candidato k é o tabuleiro de fill(clicada, semente k, safeRadius), com
+// a semente 0 igual a seed (o mesmo tabuleiro do modo normal). Os
+// candidatos são avaliados em paralelo, mas o vencedor é sempre o de menor
+// índice, então a mesma semente gera o mesmo tabuleiro com qualquer número
+// de threads. Se nenhum dos maxCandidates servir, o tabuleiro fica com o
+// candidato 0.
+//
+// Executor das tarefas auxiliares da busca: recebe cada uma e a roda em
+// outra thread (num pool de tarefas, por exemplo)
+using NoGuessExecutor = std::function<void(std::function<void()>)>;
+
+// O tabuleiro deve ter sido criado ou limpo com reset()/clear(), como em
+// Board::fill(). threads = 0 usa todos os núcleos disponíveis; a thread que
+// chama conta como uma delas. Sem executor as auxiliares são threads
+// próprias; com um, são tarefas dele, e as que só começam depois do fim da
+// busca retornam sem fazer nada (quem chama não espera por elas, então um
+// pool ocupado não trava a busca).
+NoGuessResult fillNoGuess(Board& board, int clicada, std::uint64_t seed, int safeRadius,
+                          int maxCandidates = 10000, unsigned threads = 0,
+                          const NoGuessExecutor& executor = {});
+
+#endif
@@ -0,0 +1,857 @@
+#include <array>
+
+const std::array<unsigned char, 10240> GLYPHS_SDF{ 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x10, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 
+    0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x23, 0x2f, 0x2f, 0x24, 
+    0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x30, 0x27, 0x14, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x23, 0x2f, 0x3d, 0x4e, 0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 
+    0x29, 0x41, 0x4f, 0x50, 0x50, 0x4f, 0x41, 0x29, 0x0d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+    0x0f, 0x12, 0x12, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x15, 0x16, 0x15, 0x10, 0x08, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0a, 0x11, 0x16, 0x16, 0x14, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+    0x0f, 0x12, 0x12, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+    0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x09, 0x12, 0x17, 0x18, 0x16, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x17, 0x19, 0x18, 0x13, 0x0b, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 
+    0x50, 0x6a, 0x6b, 0x5d, 0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x16, 0x35, 0x54, 0x6d, 0x70, 
+    0x70, 0x6d, 0x54, 0x35, 0x16, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x20, 0x2e, 0x32, 0x32, 0x30, 
+    0x23, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x19, 
+    0x25, 0x2f, 0x34, 0x36, 0x35, 0x2f, 0x26, 0x19, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1d, 0x28, 0x31, 0x35, 0x36, 
+    0x33, 0x2c, 0x21, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x2d, 0x32, 0x32, 0x31, 
+    0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x29, 0x31, 
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x0f, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x26, 0x30, 0x36, 
+    0x38, 0x35, 0x2f, 0x25, 0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x25, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
+    0x31, 0x27, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 
+    0x26, 0x31, 0x37, 0x39, 0x37, 0x32, 0x29, 0x1c, 0x0b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6a, 0x70, 0x70, 0x87, 0x79, 
+    0x6b, 0x5d, 0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+    0x15, 0x21, 0x22, 0x19, 0x37, 0x57, 0x76, 0x90, 0x90, 0x76, 0x57, 0x37, 
+    0x19, 0x22, 0x21, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x10, 0x1f, 0x2d, 0x3c, 0x4b, 0x52, 0x52, 0x4e, 0x3b, 0x21, 0x04, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x35, 0x43, 0x4d, 0x54, 0x56, 
+    0x54, 0x4e, 0x43, 0x34, 0x22, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x17, 0x2a, 0x3a, 0x47, 0x50, 0x55, 0x56, 0x52, 0x4b, 0x3e, 0x2d, 
+    0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1b, 0x35, 0x4a, 0x52, 0x52, 0x50, 0x40, 0x27, 0x0b, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x44, 0x51, 0x51, 0x51, 0x51, 0x51, 
+    0x51, 0x51, 0x51, 0x51, 0x4e, 0x3c, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0c, 0x21, 0x34, 0x43, 0x4f, 0x56, 0x57, 0x55, 0x4d, 0x42, 
+    0x32, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x3f, 0x4f, 0x51, 
+    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x50, 0x42, 0x2a, 0x0e, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x33, 0x43, 0x4f, 0x56, 0x58, 
+    0x57, 0x51, 0x46, 0x37, 0x24, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x95, 0x87, 0x79, 0x6b, 0x5d, 
+    0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x30, 0x3f, 0x41, 0x35, 
+    0x37, 0x57, 0x76, 0x96, 0x96, 0x76, 0x57, 0x37, 0x35, 0x41, 0x3f, 0x30, 
+    0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x2c, 0x3b, 0x49, 0x58, 
+    0x67, 0x72, 0x72, 0x68, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x28, 0x3e, 0x50, 0x60, 0x6c, 0x73, 0x76, 0x74, 0x6c, 0x60, 0x4e, 
+    0x3a, 0x23, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2f, 0x44, 0x56, 
+    0x64, 0x6e, 0x74, 0x75, 0x72, 0x68, 0x5a, 0x46, 0x30, 0x17, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x47, 
+    0x61, 0x72, 0x72, 0x6d, 0x51, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1a, 0x39, 0x57, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 
+    0x69, 0x4d, 0x2e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x39, 
+    0x4e, 0x60, 0x6d, 0x75, 0x77, 0x74, 0x6b, 0x5e, 0x4c, 0x38, 0x20, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x12, 0x32, 0x51, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x71, 
+    0x71, 0x71, 0x71, 0x71, 0x6e, 0x54, 0x36, 0x16, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x1e, 0x37, 0x4d, 0x5f, 0x6d, 0x75, 0x78, 0x76, 0x6f, 0x62, 0x51, 
+    0x3c, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x90, 0xb0, 0xa3, 0x95, 0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 
+    0x32, 0x24, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x03, 0x1a, 0x30, 0x46, 0x5c, 0x60, 0x4c, 0x3a, 0x57, 0x76, 0x96, 
+    0x96, 0x76, 0x57, 0x3a, 0x4c, 0x60, 0x5c, 0x46, 0x30, 0x1a, 0x03, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x1d, 0x36, 0x48, 0x57, 0x66, 0x74, 0x83, 0x91, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x24, 0x3e, 0x55, 0x6a, 
+    0x7c, 0x8a, 0x92, 0x95, 0x93, 0x8a, 0x7b, 0x67, 0x4f, 0x36, 0x1b, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0a, 0x28, 0x44, 0x5c, 0x70, 0x81, 0x8d, 0x94, 0x95, 
+    0x91, 0x85, 0x73, 0x5d, 0x43, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x24, 0x3e, 0x58, 0x73, 0x8d, 0x91, 0x73, 
+    0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x7b, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x6f, 0x4f, 0x2f, 0x0f, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x36, 0x4f, 0x66, 0x7a, 0x8a, 0x94, 
+    0x97, 0x93, 0x89, 0x79, 0x65, 0x4c, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
+    0x33, 0x53, 0x73, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x77, 0x57, 0x37, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x4b, 0x64, 
+    0x79, 0x8a, 0x95, 0x98, 0x96, 0x8d, 0x7e, 0x69, 0x50, 0x35, 0x19, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0xb0, 
+    0xc0, 0xb2, 0xa3, 0x95, 0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 0x31, 0x1a, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x46, 
+    0x5d, 0x73, 0x79, 0x63, 0x57, 0x63, 0x76, 0x96, 0x96, 0x76, 0x63, 0x57, 
+    0x63, 0x79, 0x73, 0x5d, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x48, 
+    0x63, 0x73, 0x82, 0x90, 0x9f, 0xa7, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1a, 0x36, 0x51, 0x6a, 0x82, 0x97, 0x95, 0x8a, 0x85, 
+    0x88, 0x95, 0x94, 0x7c, 0x62, 0x46, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+    0x2f, 0x4f, 0x6e, 0x89, 0x9d, 0x8e, 0x86, 0x84, 0x8e, 0xa0, 0x89, 0x6f, 
+    0x53, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x1b, 0x36, 0x50, 0x6a, 0x85, 0x9f, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x3e, 0x5d, 0x7d, 0x9d, 0x8a, 0x8a, 0x8a, 
+    0x8a, 0x8a, 0x8a, 0x8a, 0x6f, 0x4f, 0x2f, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x2c, 0x48, 0x63, 0x7c, 0x93, 0x95, 0x88, 0x84, 0x88, 0x97, 0x88, 
+    0x70, 0x51, 0x32, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x53, 0x73, 0x8d, 
+    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x91, 0x73, 0x56, 0x36, 0x17, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x3e, 0x5b, 0x77, 0x90, 0x96, 0x86, 0x81, 
+    0x85, 0x95, 0x96, 0x7c, 0x60, 0x43, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0xb0, 0xcf, 0xce, 0xc0, 0xb2, 
+    0xa3, 0x95, 0x87, 0x79, 0x6b, 0x5d, 0x47, 0x2b, 0x0c, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x3f, 0x5c, 0x73, 0x8a, 0x90, 0x79, 
+    0x74, 0x81, 0x8a, 0x96, 0x96, 0x8a, 0x81, 0x74, 0x79, 0x90, 0x8a, 0x73, 
+    0x5c, 0x3f, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x69, 0x87, 0x94, 0x8b, 
+    0x81, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 
+    0x43, 0x61, 0x7c, 0x97, 0x8e, 0x7a, 0x6b, 0x65, 0x6a, 0x7d, 0x97, 0x8c, 
+    0x6f, 0x51, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x46, 0x5f, 0x75, 
+    0x83, 0x71, 0x66, 0x65, 0x73, 0x8d, 0x9a, 0x7c, 0x5e, 0x3f, 0x20, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x47, 0x62, 0x7c, 
+    0x96, 0xa8, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x40, 0x5f, 0x7f, 0x9e, 0x7e, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 
+    0x64, 0x4a, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x57, 0x73, 
+    0x8f, 0x93, 0x7c, 0x6a, 0x64, 0x6b, 0x83, 0x73, 0x5b, 0x43, 0x29, 0x0c, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x12, 0x31, 0x4f, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 
+    0x6d, 0x82, 0xa0, 0x85, 0x68, 0x4a, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x28, 0x47, 0x66, 0x84, 0x9d, 0x81, 0x69, 0x61, 0x69, 0x7f, 0x9b, 0x89, 
+    0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x90, 0xb0, 0xcf, 0xea, 0xdc, 0xce, 0xc0, 0xb2, 0xa3, 0x95, 
+    0x87, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x22, 0x41, 0x60, 0x79, 0x90, 0xa6, 0x90, 0x8f, 0x9e, 0xa9, 0xaf, 
+    0xaf, 0xa9, 0x9e, 0x8f, 0x90, 0xa6, 0x90, 0x79, 0x60, 0x41, 0x22, 0x03, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x05, 0x23, 0x41, 0x5e, 0x7c, 0x76, 0x6d, 0x78, 0x98, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x42, 0x5f, 0x74, 0x87, 
+    0x7b, 0x61, 0x4e, 0x45, 0x50, 0x6e, 0x8d, 0x96, 0x77, 0x58, 0x38, 0x18, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x32, 0x48, 0x5f, 0x6a, 0x56, 0x48, 0x47, 
+    0x63, 0x82, 0xa2, 0x82, 0x63, 0x43, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0a, 0x25, 0x3f, 0x59, 0x73, 0x8e, 0x8d, 0x92, 0x93, 0x73, 
+    0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x42, 0x62, 0x81, 
+    0x9c, 0x7c, 0x5d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x47, 0x37, 0x1f, 0x03, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x09, 0x27, 0x46, 0x64, 0x81, 0x9e, 0x81, 0x67, 0x4f, 
+    0x44, 0x59, 0x6d, 0x5e, 0x46, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x24, 0x3c, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x70, 0x8e, 0x97, 0x79, 
+    0x5c, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2b, 0x4b, 0x6a, 0x8a, 
+    0x97, 0x77, 0x57, 0x41, 0x54, 0x74, 0x93, 0x8e, 0x6e, 0x4f, 0x2f, 0x0f, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0xb0, 
+    0xcf, 0xce, 0xc0, 0xb2, 0xa3, 0x95, 0x87, 0x79, 0x6b, 0x5d, 0x47, 0x2b, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x19, 0x35, 0x4c, 
+    0x63, 0x79, 0x90, 0xa6, 0xa9, 0xbb, 0xc8, 0xce, 0xce, 0xc8, 0xbb, 0xa9, 
+    0xa6, 0x90, 0x79, 0x63, 0x4c, 0x35, 0x19, 0x16, 0x0d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 
+    0x50, 0x5e, 0x58, 0x58, 0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x18, 0x32, 0x47, 0x5a, 0x6e, 0x70, 0x55, 0x36, 0x2b, 
+    0x4b, 0x6a, 0x8a, 0x99, 0x79, 0x59, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x1b, 0x32, 0x45, 0x4b, 0x3f, 0x37, 0x45, 0x64, 0x83, 0xa1, 0x81, 
+    0x62, 0x42, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x36, 
+    0x51, 0x6b, 0x85, 0x96, 0x7c, 0x92, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x64, 0x83, 0x9a, 0x7b, 0x5c, 0x60, 
+    0x5e, 0x58, 0x4d, 0x3e, 0x2b, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x30, 0x4e, 0x6d, 0x8c, 0x93, 0x75, 0x57, 0x5d, 0x5d, 0x57, 0x4d, 0x46, 
+    0x32, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2d, 0x2e, 
+    0x2e, 0x2e, 0x40, 0x5e, 0x7b, 0x99, 0x8b, 0x6e, 0x50, 0x33, 0x15, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0a, 0x2a, 0x49, 0x68, 0x88, 0x9a, 0x7c, 0x60, 0x4a, 
+    0x5b, 0x78, 0x96, 0x8a, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0xb0, 0xc0, 0xb2, 0xa3, 0x95, 
+    0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 0x31, 0x1a, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x14, 0x29, 0x35, 0x37, 0x37, 0x3a, 0x57, 0x74, 0x8f, 0xa9, 
+    0xc1, 0xd6, 0xe5, 0xee, 0xee, 0xe5, 0xd6, 0xc1, 0xa9, 0x8f, 0x74, 0x57, 
+    0x3a, 0x37, 0x37, 0x35, 0x29, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x36, 0x3f, 0x39, 0x58, 
+    0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
+    0x1b, 0x2e, 0x41, 0x53, 0x55, 0x43, 0x2b, 0x33, 0x51, 0x6f, 0x8e, 0x95, 
+    0x76, 0x57, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x33, 
+    0x4b, 0x56, 0x57, 0x5f, 0x71, 0x8c, 0x96, 0x79, 0x5b, 0x3d, 0x1e, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x48, 0x62, 0x7d, 0x97, 0x85, 
+    0x72, 0x92, 0x93, 0x73, 0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+    0x26, 0x46, 0x66, 0x85, 0x98, 0x79, 0x7b, 0x7f, 0x7e, 0x76, 0x69, 0x58, 
+    0x42, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x55, 0x74, 0x93, 
+    0x8c, 0x6c, 0x74, 0x7c, 0x7c, 0x75, 0x68, 0x55, 0x3f, 0x27, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0e, 0x0f, 0x2d, 0x4b, 0x69, 
+    0x86, 0x9e, 0x80, 0x62, 0x45, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
+    0x24, 0x42, 0x60, 0x7d, 0x98, 0x8c, 0x76, 0x64, 0x6d, 0x86, 0x9a, 0x7f, 
+    0x62, 0x44, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x90, 0xb0, 0xa3, 0x95, 0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 
+    0x32, 0x24, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x41, 
+    0x54, 0x57, 0x57, 0x57, 0x63, 0x81, 0x9e, 0xbb, 0xd6, 0xee, 0xff, 0xff, 
+    0xff, 0xff, 0xee, 0xd6, 0xbb, 0x9e, 0x81, 0x63, 0x57, 0x57, 0x57, 0x54, 
+    0x41, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0a, 0x19, 0x1f, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x28, 0x35, 
+    0x36, 0x2b, 0x29, 0x43, 0x5e, 0x7a, 0x97, 0x8c, 0x6e, 0x50, 0x31, 0x12, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5e, 0x76, 0x77, 0x7c, 
+    0x8a, 0x97, 0x83, 0x6a, 0x4f, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x25, 0x40, 0x5a, 0x74, 0x8f, 0x8e, 0x74, 0x72, 0x92, 0x93, 0x73, 
+    0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x48, 0x68, 0x87, 
+    0x9a, 0x8e, 0x9a, 0x98, 0x9d, 0x94, 0x84, 0x6f, 0x58, 0x3d, 0x22, 0x06, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1a, 0x3a, 0x59, 0x79, 0x98, 0x88, 0x80, 0x91, 0x9b, 
+    0x9c, 0x92, 0x82, 0x6c, 0x54, 0x39, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x56, 0x74, 0x91, 0x93, 0x75, 0x57, 
+    0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x36, 0x52, 0x6c, 
+    0x84, 0x98, 0x90, 0x7f, 0x84, 0x9a, 0x85, 0x6e, 0x54, 0x38, 0x1b, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x95, 
+    0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x4f, 0x6d, 0x76, 0x76, 0x76, 
+    0x76, 0x8a, 0xa9, 0xc8, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 
+    0xc8, 0xa9, 0x8a, 0x76, 0x76, 0x76, 0x76, 0x6d, 0x4f, 0x30, 0x10, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x19, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x17, 0x25, 0x3d, 0x56, 
+    0x6f, 0x8a, 0x9a, 0x7e, 0x62, 0x45, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x20, 0x40, 0x60, 0x7f, 0x96, 0x9b, 0x92, 0x7b, 0x6d, 0x5a, 
+    0x44, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x37, 0x51, 0x6c, 
+    0x86, 0x97, 0x7d, 0x62, 0x72, 0x92, 0x93, 0x73, 0x54, 0x34, 0x1c, 0x0b, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0b, 0x2a, 0x4a, 0x6a, 0x89, 0x9a, 0x88, 0x7c, 0x78, 
+    0x7f, 0x8f, 0x9c, 0x84, 0x69, 0x4d, 0x2f, 0x11, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 
+    0x3c, 0x5c, 0x7b, 0x9b, 0x88, 0x96, 0x86, 0x7d, 0x81, 0x90, 0x99, 0x80, 
+    0x65, 0x48, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
+    0x24, 0x42, 0x60, 0x7e, 0x9c, 0x88, 0x6a, 0x4c, 0x2e, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x47, 0x5d, 0x70, 0x7f, 0x9d, 0x9b, 
+    0x9e, 0x81, 0x71, 0x5e, 0x48, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x87, 0x79, 0x6b, 0x5d, 0x4e, 0x40, 
+    0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x96, 0x96, 0x96, 0x96, 0xaf, 0xce, 
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xce, 0xaf, 0x96, 0x96, 
+    0x96, 0x96, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 
+    0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0e, 0x24, 0x3b, 0x52, 0x6a, 0x83, 0x9c, 0x88, 0x6e, 
+    0x53, 0x37, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 
+    0x60, 0x7f, 0x7f, 0x82, 0x8c, 0x98, 0x87, 0x71, 0x57, 0x3c, 0x20, 0x02, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x14, 0x2f, 0x49, 0x63, 0x7e, 0x98, 0x86, 0x6b, 0x52, 
+    0x72, 0x92, 0x93, 0x73, 0x54, 0x44, 0x38, 0x21, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 
+    0x2b, 0x4b, 0x6a, 0x7c, 0x83, 0x6e, 0x5e, 0x59, 0x63, 0x79, 0x93, 0x93, 
+    0x76, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5d, 0x7c, 0x9c, 
+    0x98, 0x7f, 0x6b, 0x5d, 0x64, 0x79, 0x94, 0x8f, 0x71, 0x53, 0x34, 0x16, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4d, 0x6b, 0x89, 
+    0x9c, 0x7e, 0x60, 0x42, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+    0x27, 0x43, 0x5c, 0x74, 0x8a, 0x95, 0x83, 0x7f, 0x8d, 0x9d, 0x8b, 0x75, 
+    0x5c, 0x42, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x70, 0x5d, 0x4e, 0x40, 0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 
+    0x70, 0x90, 0x96, 0x96, 0x96, 0x96, 0xaf, 0xce, 0xee, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xee, 0xce, 0xaf, 0x96, 0x96, 0x96, 0x96, 0x90, 0x70, 
+    0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x24, 
+    0x3b, 0x51, 0x68, 0x7f, 0x97, 0x8d, 0x74, 0x5b, 0x42, 0x27, 0x0c, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x39, 0x53, 0x61, 0x5f, 0x63, 
+    0x70, 0x85, 0x9e, 0x83, 0x67, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 
+    0x40, 0x5b, 0x75, 0x8f, 0x8f, 0x74, 0x65, 0x65, 0x72, 0x92, 0x93, 0x73, 
+    0x65, 0x63, 0x4e, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x3e, 0x53, 0x5e, 
+    0x67, 0x57, 0x41, 0x39, 0x4c, 0x69, 0x87, 0x9d, 0x7e, 0x5f, 0x40, 0x20, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7c, 0x9c, 0x89, 0x6b, 0x52, 0x3f, 
+    0x4d, 0x6a, 0x89, 0x99, 0x79, 0x5a, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1b, 0x39, 0x57, 0x75, 0x93, 0x91, 0x73, 0x55, 0x37, 
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x52, 0x6e, 0x89, 
+    0x98, 0x7e, 0x69, 0x62, 0x72, 0x86, 0x9e, 0x88, 0x6d, 0x51, 0x33, 0x15, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x70, 0x50, 
+    0x32, 0x24, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x4f, 0x6d, 0x76, 0x76, 0x76, 
+    0x76, 0x8a, 0xa9, 0xc8, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 
+    0xc8, 0xa9, 0x8a, 0x76, 0x76, 0x76, 0x76, 0x6d, 0x4f, 0x30, 0x10, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x19, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x24, 0x3b, 0x51, 0x67, 0x7e, 0x95, 
+    0x8f, 0x77, 0x60, 0x48, 0x2f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x18, 0x2e, 0x3c, 0x3c, 0x41, 0x40, 0x45, 0x59, 0x77, 0x96, 0x8f, 
+    0x70, 0x51, 0x32, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2b, 0x4b, 0x6a, 0x87, 0xa0, 
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x92, 0x94, 0x85, 0x85, 0x75, 0x55, 0x36, 
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x27, 0x35, 0x40, 0x47, 0x3e, 0x2a, 0x23, 
+    0x42, 0x62, 0x82, 0xa1, 0x82, 0x62, 0x42, 0x23, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 
+    0x3a, 0x5a, 0x79, 0x99, 0x89, 0x69, 0x4a, 0x2a, 0x45, 0x64, 0x84, 0x9d, 
+    0x7d, 0x5d, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 
+    0x43, 0x61, 0x7f, 0x9d, 0x87, 0x69, 0x4b, 0x2d, 0x0f, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1f, 0x3e, 0x5d, 0x7c, 0x99, 0x8a, 0x6c, 0x51, 0x46, 
+    0x59, 0x72, 0x8e, 0x97, 0x79, 0x5b, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x09, 0x27, 0x41, 0x54, 0x57, 0x57, 0x57, 0x63, 0x81, 0x9e, 0xbb, 
+    0xd6, 0xee, 0xff, 0xff, 0xff, 0xff, 0xee, 0xd6, 0xbb, 0x9e, 0x81, 0x63, 
+    0x57, 0x57, 0x57, 0x54, 0x41, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 
+    0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0e, 0x24, 0x3b, 0x51, 0x67, 0x7e, 0x94, 0x8f, 0x79, 0x62, 0x4b, 0x33, 
+    0x33, 0x2b, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2c, 0x45, 0x5a, 
+    0x5a, 0x46, 0x2c, 0x33, 0x53, 0x73, 0x92, 0x93, 0x73, 0x54, 0x34, 0x14, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0b, 0x2b, 0x4b, 0x6b, 0x8a, 0x93, 0x93, 0x93, 0x93, 0x93, 
+    0x93, 0x9b, 0x9c, 0x94, 0x94, 0x75, 0x55, 0x36, 0x16, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
+    0x1e, 0x31, 0x45, 0x58, 0x64, 0x53, 0x39, 0x25, 0x44, 0x63, 0x82, 0xa1, 
+    0x81, 0x62, 0x42, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x55, 0x74, 0x93, 
+    0x8d, 0x6e, 0x50, 0x32, 0x46, 0x65, 0x85, 0x9c, 0x7c, 0x5d, 0x3d, 0x1d, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2f, 0x4d, 0x6b, 0x8a, 0x9c, 
+    0x7e, 0x5f, 0x41, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 
+    0x43, 0x63, 0x82, 0xa2, 0x83, 0x63, 0x44, 0x2c, 0x47, 0x66, 0x86, 0x9f, 
+    0x7f, 0x60, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x29, 
+    0x35, 0x37, 0x37, 0x3a, 0x57, 0x74, 0x8f, 0xa9, 0xc1, 0xd6, 0xe5, 0xee, 
+    0xee, 0xe5, 0xd6, 0xc1, 0xa9, 0x8f, 0x74, 0x57, 0x3a, 0x37, 0x37, 0x35, 
+    0x29, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x23, 0x3b, 0x51, 0x68, 
+    0x7e, 0x94, 0x8f, 0x79, 0x62, 0x4c, 0x4a, 0x4e, 0x52, 0x46, 0x2e, 0x13, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0c, 0x26, 0x3f, 0x58, 0x72, 0x73, 0x55, 0x42, 0x42, 
+    0x59, 0x77, 0x96, 0x90, 0x71, 0x52, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 
+    0x49, 0x67, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x92, 0x93, 0x74, 
+    0x74, 0x70, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x32, 0x4a, 0x5e, 0x71, 
+    0x80, 0x61, 0x49, 0x41, 0x51, 0x6c, 0x8a, 0x9b, 0x7c, 0x5d, 0x3e, 0x1f, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6d, 0x8b, 0x97, 0x79, 0x5d, 0x45, 
+    0x51, 0x6d, 0x8b, 0x96, 0x77, 0x58, 0x39, 0x1a, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1b, 0x39, 0x57, 0x75, 0x93, 0x92, 0x74, 0x56, 0x37, 0x19, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x43, 0x62, 0x82, 0xa1, 
+    0x86, 0x68, 0x4d, 0x44, 0x4e, 0x6a, 0x88, 0x9e, 0x7e, 0x5f, 0x3f, 0x20, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x10, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x70, 0x50, 
+    0x31, 0x11, 0x11, 0x11, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x19, 0x35, 0x4c, 
+    0x63, 0x79, 0x90, 0xa6, 0xa9, 0xbb, 0xc8, 0xce, 0xce, 0xc8, 0xbb, 0xa9, 
+    0xa6, 0x90, 0x79, 0x63, 0x4c, 0x35, 0x19, 0x16, 0x0d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x19, 0x38, 0x58, 0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x15, 0x33, 0x50, 0x67, 0x7e, 0x95, 0x90, 0x79, 0x6a, 
+    0x6a, 0x6a, 0x6a, 0x6a, 0x72, 0x59, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 
+    0x37, 0x53, 0x6c, 0x85, 0x80, 0x6d, 0x62, 0x61, 0x6d, 0x84, 0xa0, 0x87, 
+    0x69, 0x4b, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3b, 0x4f, 0x53, 0x53, 
+    0x53, 0x53, 0x53, 0x53, 0x73, 0x92, 0x93, 0x73, 0x54, 0x53, 0x43, 0x2a, 
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x77, 0x8a, 0x8d, 0x75, 0x65, 0x61, 
+    0x6a, 0x7e, 0x98, 0x8e, 0x72, 0x54, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x27, 0x45, 0x62, 0x7f, 0x9b, 0x8a, 0x72, 0x63, 0x68, 0x7d, 0x97, 0x8a, 
+    0x6d, 0x4f, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x42, 
+    0x61, 0x7f, 0x9d, 0x89, 0x6b, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x1e, 0x3d, 0x5c, 0x7a, 0x97, 0x93, 0x7a, 0x69, 0x64, 
+    0x69, 0x7b, 0x94, 0x93, 0x76, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x2f, 
+    0x31, 0x31, 0x50, 0x70, 0x90, 0x90, 0x70, 0x50, 0x31, 0x31, 0x31, 0x31, 
+    0x2f, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x41, 0x60, 0x79, 0x90, 0xa6, 0x90, 
+    0x8f, 0x9e, 0xa9, 0xaf, 0xaf, 0xa9, 0x9e, 0x8f, 0x90, 0xa6, 0x90, 0x79, 
+    0x60, 0x41, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 
+    0x78, 0x98, 0x8c, 0x6d, 0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+    0x38, 0x58, 0x78, 0x94, 0xa3, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 
+    0x7c, 0x5c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3e, 0x5d, 0x7c, 0x92, 
+    0x99, 0x89, 0x81, 0x81, 0x89, 0x9a, 0x90, 0x77, 0x5c, 0x40, 0x22, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0e, 0x23, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x53, 
+    0x73, 0x92, 0x93, 0x73, 0x54, 0x34, 0x2a, 0x16, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 
+    0x3a, 0x57, 0x71, 0x88, 0x9d, 0x8f, 0x84, 0x81, 0x87, 0x96, 0x94, 0x7d, 
+    0x63, 0x47, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x38, 0x54, 0x6f, 
+    0x89, 0x9f, 0x8c, 0x82, 0x85, 0x94, 0x92, 0x7a, 0x5f, 0x43, 0x26, 0x09, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x6a, 0x89, 0x9e, 0x80, 
+    0x62, 0x43, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
+    0x33, 0x50, 0x6b, 0x85, 0x9b, 0x93, 0x87, 0x83, 0x87, 0x94, 0x98, 0x82, 
+    0x68, 0x4c, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 0x50, 0x50, 0x50, 0x70, 
+    0x90, 0x90, 0x70, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3d, 0x23, 0x07, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x21, 0x3f, 0x5c, 0x73, 0x8a, 0x90, 0x79, 0x74, 0x81, 0x8a, 0x96, 
+    0x96, 0x8a, 0x81, 0x74, 0x79, 0x90, 0x8a, 0x73, 0x5c, 0x3f, 0x21, 0x02, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 0x78, 0x8f, 0x8c, 0x6d, 
+    0x4d, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x8f, 
+    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x7c, 0x5c, 0x3c, 0x1c, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x18, 0x36, 0x50, 0x66, 0x79, 0x88, 0x92, 0x97, 0x98, 
+    0x94, 0x89, 0x78, 0x63, 0x4b, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x12, 0x14, 0x14, 0x14, 0x14, 0x33, 0x53, 0x73, 0x8f, 0x8f, 0x73, 
+    0x54, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x44, 0x5c, 0x71, 
+    0x82, 0x8f, 0x96, 0x98, 0x95, 0x8b, 0x7c, 0x67, 0x50, 0x37, 0x1c, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x43, 0x5c, 0x73, 0x86, 0x92, 0x97, 
+    0x95, 0x8b, 0x7b, 0x65, 0x4d, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x18, 0x37, 0x55, 0x74, 0x8f, 0x8f, 0x77, 0x59, 0x3a, 0x1c, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3f, 0x58, 0x6e, 
+    0x81, 0x8e, 0x96, 0x98, 0x95, 0x8d, 0x7f, 0x6c, 0x55, 0x3c, 0x21, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x2f, 0x4e, 0x6a, 0x70, 0x70, 0x70, 0x70, 0x90, 0x90, 0x70, 0x70, 
+    0x70, 0x70, 0x70, 0x70, 0x6a, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x46, 
+    0x5d, 0x73, 0x79, 0x63, 0x57, 0x63, 0x76, 0x96, 0x96, 0x76, 0x63, 0x57, 
+    0x63, 0x79, 0x73, 0x5d, 0x46, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x17, 0x37, 0x55, 0x6e, 0x70, 0x70, 0x67, 0x4a, 0x2b, 0x0c, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x17, 0x36, 0x55, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 
+    0x70, 0x70, 0x70, 0x70, 0x6f, 0x58, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 
+    0x23, 0x39, 0x4d, 0x5d, 0x6a, 0x73, 0x78, 0x78, 0x75, 0x6c, 0x5e, 0x4b, 
+    0x36, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x12, 0x32, 0x50, 0x6b, 0x70, 0x70, 0x6b, 0x51, 0x32, 0x13, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x2f, 0x44, 0x56, 0x65, 0x70, 0x77, 0x79, 
+    0x76, 0x6e, 0x61, 0x4f, 0x3b, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x17, 0x2f, 0x46, 0x5a, 0x69, 0x74, 0x78, 0x76, 0x6e, 0x60, 0x4e, 
+    0x38, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 
+    0x6e, 0x70, 0x70, 0x6b, 0x50, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x2b, 0x42, 0x55, 0x65, 0x70, 0x76, 0x78, 
+    0x76, 0x6f, 0x63, 0x53, 0x3f, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x30, 0x46, 0x5c, 0x60, 0x4c, 
+    0x3a, 0x57, 0x76, 0x96, 0x96, 0x76, 0x57, 0x3a, 0x4c, 0x60, 0x5c, 0x46, 
+    0x30, 0x1a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x42, 
+    0x4f, 0x50, 0x50, 0x4c, 0x3a, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+    0x2a, 0x42, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+    0x50, 0x44, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x32, 0x41, 
+    0x4c, 0x54, 0x58, 0x59, 0x55, 0x4e, 0x42, 0x32, 0x1f, 0x09, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x26, 0x3e, 
+    0x4e, 0x50, 0x50, 0x4e, 0x3f, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x17, 0x2a, 0x3b, 0x48, 0x52, 0x57, 0x59, 0x57, 0x50, 0x45, 0x35, 
+    0x23, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x2e, 
+    0x3f, 0x4c, 0x55, 0x58, 0x57, 0x50, 0x44, 0x35, 0x21, 0x0b, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x42, 0x4f, 0x50, 0x50, 0x4e, 
+    0x3e, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x15, 0x29, 0x3a, 0x48, 0x51, 0x57, 0x58, 0x56, 0x50, 0x46, 0x38, 
+    0x26, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0, 0xb0, 0xb0, 
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x03, 0x1a, 0x30, 0x3f, 0x41, 0x35, 0x37, 0x57, 0x76, 0x96, 
+    0x96, 0x76, 0x57, 0x37, 0x35, 0x41, 0x3f, 0x30, 0x1a, 0x03, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x27, 0x30, 0x30, 0x30, 0x2e, 
+    0x21, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x27, 0x30, 0x30, 
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x28, 0x17, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x16, 0x23, 0x2e, 0x35, 0x38, 0x39, 
+    0x36, 0x2f, 0x25, 0x17, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x2f, 0x30, 0x30, 0x2f, 
+    0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1e, 
+    0x2a, 0x33, 0x38, 0x39, 0x37, 0x31, 0x27, 0x1a, 0x09, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x22, 0x2e, 0x35, 0x38, 
+    0x37, 0x31, 0x27, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x15, 0x27, 0x30, 0x30, 0x30, 0x2f, 0x24, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, 
+    0x2a, 0x32, 0x37, 0x38, 0x37, 0x31, 0x28, 0x1c, 0x0c, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x90, 0x90, 0x90, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+    0x15, 0x21, 0x22, 0x19, 0x37, 0x57, 0x76, 0x90, 0x90, 0x76, 0x57, 0x37, 
+    0x19, 0x22, 0x21, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0a, 0x10, 0x10, 0x10, 0x0f, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x06, 0x0f, 0x15, 0x19, 0x19, 0x17, 0x11, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x10, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x14, 0x18, 0x19, 
+    0x18, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x16, 0x18, 0x17, 0x12, 0x0a, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 
+    0x10, 0x10, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x13, 0x17, 0x19, 
+    0x17, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6a, 
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
+    0x6a, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x16, 
+    0x35, 0x54, 0x6d, 0x70, 0x70, 0x6d, 0x54, 0x35, 0x16, 0x03, 0x02, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 0x50, 0x50, 0x50, 0x50, 
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3d, 0x23, 0x07, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x41, 0x4f, 0x50, 
+    0x50, 0x4f, 0x41, 0x29, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 
+    0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x27, 0x30, 0x31, 0x31, 0x30, 0x27, 0x14, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
+    0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x09, 0x10, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00 };
@@ -0,0 +1,23 @@
+#ifndef GLYPHS_HPP_
+#define GLYPHS_HPP_
+
+// Atlas de glifos das células: campos de distância com sinal (SDF) dos
+// dígitos 1 a 8, da bandeira e da bomba, um ao lado do outro numa única
+// linha de count * size x size texels de 8 bits. Cada texel guarda a
+// distância até o contorno, 128 no contorno e crescendo para dentro
+// (spread texels valem 127 níveis), então o contorno continua nítido com a
+// textura ampliada por qualquer fator.
+//
+// O atlas é gerado por minesweeper_bakeglyphs em glyphs.sdf e
+// embutido no executável como glyphatlas.hpp (ver CMakeLists.txt).
+namespace glyphs {
+constexpr int size{32}; // lado de cada glifo, em texels
+constexpr int spread{4}; // distância máxima representada, em texels
+constexpr int count{10};
+constexpr int flag{8}; // índice da bandeira; os dígitos n estão em n - 1
+constexpr int mine{9};
+constexpr int width{count * size}; // dimensões do atlas
+constexpr int height{size};
+}  // namespace glyphs
+
+#endif
@@ -0,0 +1,121 @@
+#include "history.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+void escreverVarint(std::vector<std::uint8_t> &saida, std::uint32_t valor) {
+  while(valor >= 0x80)
+  {
+    saida.push_back(static_cast<std::uint8_t>(valor | 0x80));
+    valor >>= 7;
+  }
+  saida.push_back(static_cast<std::uint8_t>(valor));
+}
+
+std::uint32_t lerVarint(const std::uint8_t *&p) {
+  std::uint32_t valor{};
+  for(int deslocamento = 0;; deslocamento += 7)
+  {
+    const auto byte{*p++};
+    valor |= static_cast<std::uint32_t>(byte & 0x7F) << deslocamento;
+    if((byte & 0x80) == 0) return valor;
+  }
+}
+}  // namespace
+
+void History::clear() {
+  m_passos.clear();
+  m_atual = 0;
+  m_dados.clear();
+}
+
+void History::descartarDesfeitos() {
+  if(!canRedo()) return;
+  m_dados.resize(m_atual > 0 ? m_passos[m_atual - 1].fim : 0);
+  m_passos.resize(m_atual);
+}
+
+void History::recordReveal(const std::vector<int> &revealed) {
+  if(revealed.empty()) return;
+  descartarDesfeitos();
+
+  // bitmap das células do passo, de menor a maior
+  const auto [menor, maior]{std::minmax_element(revealed.begin(), revealed.end())};
+  const int base = *menor;
+  const auto bits{static_cast<std::size_t>(*maior - base) + 1};
+  m_marcas.assign((bits + 63) / 64, 0);
+  for(const int o : revealed)
+  {
+    const auto k{static_cast<std::size_t>(o - base)};
+    m_marcas[k / 64] |= std::uint64_t{1} << (k % 64);
+  }
+
+  // primeira posição >= k com o bit igual a valor (ou bits, se não houver)
+  auto proxima = [&](std::size_t k, bool valor) {
+    while(k < bits)
+    {
+      const auto palavra{valor ? m_marcas[k / 64] : ~m_marcas[k / 64]};
+      const auto resto{palavra >> (k % 64)};
+      if(resto != 0) return std::min(bits, k + static_cast<std::size_t>(std::countr_zero(resto)));
+      k = (k / 64 + 1) * 64;
+    }
+    return bits;
+  };
+
+  // o primeiro offset, depois cada faixa como (células ocultas desde a
+  // faixa anterior, comprimento - 1)
+  Passo passo{m_dados.size(), 0, -1, *maior + 1};
+  escreverVarint(m_dados, static_cast<std::uint32_t>(base));
+  for(std::size_t fimAnterior = 0, inicio = 0; inicio < bits; inicio = proxima(fimAnterior, true))
+  {
+    const auto fim{proxima(inicio, false)};
+    escreverVarint(m_dados, static_cast<std::uint32_t>(inicio - fimAnterior));
+    escreverVarint(m_dados, static_cast<std::uint32_t>(fim - inicio - 1));
+    fimAnterior = fim;
+  }
+  passo.fim = m_dados.size();
+  m_passos.push_back(passo);
+  ++m_atual;
+}
+
+void History::recordFlag(int offset) {
+  descartarDesfeitos();
+  m_passos.push_back({m_dados.size(), m_dados.size(), offset, offset + 1});
+  ++m_atual;
+}
+
+bool History::undo(Board &board) {
+  if(!canUndo() || m_passos[m_atual - 1].limite > board.size()) return false;
+  aplicar(m_passos[--m_atual], board, false);
+  return true;
+}
+
+bool History::redo(Board &board) {
+  if(!canRedo() || m_passos[m_atual].limite > board.size()) return false;
+  aplicar(m_passos[m_atual++], board, true);
+  return true;
+}
+
+std::size_t History::bytes() const {
+  return m_dados.capacity() + m_passos.capacity() * sizeof(Passo) +
+         m_marcas.capacity() * sizeof(std::uint64_t);
+}
+
+void History::aplicar(const Passo &passo, Board &board, bool refazer) const {
+  if(passo.bandeira >= 0)
+  {
+    board.toggleFlag(passo.bandeira); //desfazer e refazer são o mesmo
+    return;
+  }
+  const auto *p{m_dados.data() + passo.inicio};
+  const auto *fim{m_dados.data() + passo.fim};
+  int fimAnterior = static_cast<int>(lerVarint(p));
+  while(p != fim)
+  {
+    const int inicio = fimAnterior + static_cast<int>(lerVarint(p));
+    const int n = static_cast<int>(lerVarint(p)) + 1;
+    board.setRevealed(inicio, n, refazer);
+    fimAnterior = inicio + n;
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef HISTORY_HPP_
+#define HISTORY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.hpp"
+
+// Histórico ilimitado de desfazer/refazer. Cada passo guarda só o que mudou:
+// uma bandeira é uma célula; uma revelação é a lista de células que ela
+// revelou (o preenchimento inteiro, no caso de um zero), nunca uma cópia do
+// tabuleiro.
+//
+// As células de uma revelação são marcadas num bitmap do intervalo de
+// offsets que ela cobre e guardadas como faixas de offsets consecutivos, com
+// o intervalo e o comprimento de cada faixa em varints: um preenchimento
+// ocupa poucos bytes por trecho de linha entre células ocultas, sem ordenar
+// nada. Os passos de toda a sessão ficam num único buffer. Desfazer ou
+// refazer custa O(células do passo), sem repetir o preenchimento.
+//
+// Registrar um passo novo descarta os passos desfeitos (o ramo de refazer).
+// A geração do tabuleiro não é um passo: desfazer para antes do primeiro
+// clique deixa as bombas onde estão.
+class History {
+ public:
+  void clear();
+  void recordReveal(const std::vector<int>& revealed); //células reveladas (Board::reveal); ignora listas vazias
+  void recordFlag(int offset); //bandeira posta ou tirada
+
+  // desfaz o último passo; false se não houver ou se ele não cabe no
+  // tabuleiro (células de outra partida, maior)
+  bool undo(Board& board);
+  bool redo(Board& board); //refaz o último passo desfeito; false como em undo()
+
+  [[nodiscard]] bool canUndo() const { return m_atual > 0; }
+  [[nodiscard]] bool canRedo() const { return m_atual < m_passos.size(); }
+  [[nodiscard]] std::size_t steps() const { return m_passos.size(); }
+  [[nodiscard]] std::size_t bytes() const; //memória ocupada pelos passos
+
+ private:
+  struct Passo {
+    std::size_t inicio{}; // faixas do passo em m_dados: [inicio, fim)
+    std::size_t fim{};
+    int bandeira{-1}; // célula da bandeira, ou -1 se o passo é uma revelação
+    int limite{}; // maior offset do passo + 1
+  };
+
+  std::vector<Passo> m_passos;
+  std::size_t m_atual{}; // passos aplicados; os seguintes podem ser refeitos
+  std::vector<std::uint8_t> m_dados; // faixas de todas as revelações, em ordem
+  std::vector<std::uint64_t> m_marcas; // bitmap de recordReveal, reaproveitado
+
+  void descartarDesfeitos();
+  void aplicar(const Passo& passo, Board& board, bool refazer) const;
+};
+
+#endif
@@ -0,0 +1,216 @@
+#include "infiniteboard.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "neighborcount.hpp"
+
+namespace {
+// células que o preenchimento não abre: já reveladas ou marcadas com bandeira
+constexpr Cell bloqueada{cell::revealedBit | cell::flagBit};
+
+std::uint64_t misturar(std::uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// bomba em (x, y)? Função só da configuração e das coordenadas
+bool temBomba(const InfiniteBoard::Config &config, std::uint64_t limiar, std::int64_t x,
+              std::int64_t y) {
+  if(std::abs(x - config.startX) <= config.safeRadius &&
+     std::abs(y - config.startY) <= config.safeRadius)
+    return false;
+  const auto h{misturar(config.seed ^ misturar(static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ULL +
+                                               static_cast<std::uint64_t>(y)))};
+  return h < limiar;
+}
+
+int local(std::int64_t x, std::int64_t y) {
+  constexpr std::int64_t mascara{InfiniteBoard::chunkSize - 1};
+  return static_cast<int>((y & mascara) * InfiniteBoard::chunkSize + (x & mascara));
+}
+}  // namespace
+
+void InfiniteBoard::reset(const Config &config) {
+  m_config = config;
+  m_config.density = std::clamp(config.density, minDensity, 0.9);
+  ++m_geracao;
+  m_relogio = 0;
+  m_chunks.clear();
+  m_resolvidos.clear();
+  m_pedidos.clear();
+  m_novosPedidos.clear();
+  m_pendentes.clear();
+  m_fila.clear();
+  m_reveladasSeguras = 0;
+  m_explodiu = false;
+}
+
+InfiniteBoard::Chunk *InfiniteBoard::buscar(ChunkCoord coord) {
+  const auto k{chave(coord)};
+  if(const auto it{m_chunks.find(k)}; it != m_chunks.end())
+  {
+    it->second->lastUse = ++m_relogio;
+    return it->second.get();
+  }
+  if(m_pedidos.insert(k).second) m_novosPedidos.push_back({coord, m_config, m_geracao});
+  return nullptr;
+}
+
+const InfiniteBoard::Chunk *InfiniteBoard::chunk(ChunkCoord coord) { return buscar(coord); }
+
+std::optional<Cell> InfiniteBoard::cellAt(std::int64_t x, std::int64_t y) {
+  const auto *c{buscar(chunkOf(x, y))};
+  if(c == nullptr) return std::nullopt;
+  return c->cells[local(x, y)];
+}
+
+void InfiniteBoard::reveal(std::int64_t x, std::int64_t y) {
+  m_fila.emplace_back(x, y);
+  preencher();
+}
+
+bool InfiniteBoard::toggleFlag(std::int64_t x, std::int64_t y) {
+  auto *c{buscar(chunkOf(x, y))};
+  if(c == nullptr) return false;
+  auto &celula{c->cells[local(x, y)]};
+  if(cell::isRevealed(celula)) return false;
+  celula ^= cell::flagBit;
+  return true;
+}
+
+void InfiniteBoard::chord(std::int64_t x, std::int64_t y) {
+  const auto c{cellAt(x, y)};
+  if(!c || !cell::isRevealed(*c) || cell::isMine(*c) || cell::count(*c) == 0) return;
+  int bandeiras = 0;
+  for(std::int64_t dy = -1; dy <= 1; ++dy)
+    for(std::int64_t dx = -1; dx <= 1; ++dx)
+    {
+      const auto vizinha{cellAt(x + dx, y + dy)};
+      if(!vizinha) return;
+      if(cell::isFlagged(*vizinha)) ++bandeiras;
+    }
+  if(bandeiras != cell::count(*c)) return;
+
+  for(std::int64_t dy = -1; dy <= 1; ++dy)
+    for(std::int64_t dx = -1; dx <= 1; ++dx)
+      if(dx != 0 || dy != 0) m_fila.emplace_back(x + dx, y + dy);
+  preencher();
+}
+
+void InfiniteBoard::preencher() {
+  // o chunk atual fica em cache: o preenchimento quase sempre continua no
+  // mesmo chunk, e assim o mapa só é consultado ao cruzar uma borda
+  std::uint64_t chaveAtual{};
+  Chunk *atual{};
+  while(!m_fila.empty())
+  {
+    const auto [x, y]{m_fila.back()};
+    m_fila.pop_back();
+
+    const auto coord{chunkOf(x, y)};
+    if(atual == nullptr || chave(coord) != chaveAtual)
+    {
+      chaveAtual = chave(coord);
+      atual = buscar(coord);
+    }
+    if(atual == nullptr)
+    {
+      m_pendentes[chaveAtual].emplace_back(x, y); //continua quando o chunk chegar
+      continue;
+    }
+
+    auto &celula{atual->cells[local(x, y)]};
+    if((celula & bloqueada) != 0) continue;
+    celula |= cell::revealedBit;
+    if(cell::isMine(celula))
+    {
+      m_explodiu = true;
+      continue;
+    }
+    ++atual->revealedSafe;
+    ++m_reveladasSeguras;
+    if(!cell::isZero(celula)) continue;
+
+    for(std::int64_t dy = -1; dy <= 1; ++dy)
+      for(std::int64_t dx = -1; dx <= 1; ++dx)
+        if(dx != 0 || dy != 0) m_fila.emplace_back(x + dx, y + dy);
+  }
+}
+
+std::vector<InfiniteBoard::ChunkRequest> InfiniteBoard::takeRequests() {
+  std::vector<ChunkRequest> pedidos;
+  pedidos.swap(m_novosPedidos);
+  return pedidos;
+}
+
+std::shared_ptr<InfiniteBoard::Chunk> InfiniteBoard::generate(const ChunkRequest &request) {
+  // o limiar do hash que dá a densidade pedida
+  const auto limiar{static_cast<std::uint64_t>(request.config.density * 18446744073709551616.0)};
+
+  // bombas do chunk com uma moldura de uma célula dos chunks vizinhos, para
+  // que a contagem das bordas já saia certa
+  constexpr int lado{chunkSize + 2};
+  std::array<Cell, lado * lado> moldura{};
+  const std::int64_t x0 = static_cast<std::int64_t>(request.coord.x) * chunkSize - 1;
+  const std::int64_t y0 = static_cast<std::int64_t>(request.coord.y) * chunkSize - 1;
+  for(int i = 0; i < lado; ++i)
+    for(int j = 0; j < lado; ++j)
+      if(temBomba(request.config, limiar, x0 + j, y0 + i)) moldura[i * lado + j] = cell::mineBit;
+  countNeighbors(moldura.data(), lado, lado, lado);
+
+  auto chunk{std::make_shared<Chunk>()};
+  for(int i = 0; i < chunkSize; ++i)
+    std::copy_n(moldura.begin() + (i + 1) * lado + 1, chunkSize, chunk->cells.begin() + i * chunkSize);
+  chunk->mines = static_cast<int>(
+      std::count_if(chunk->cells.begin(), chunk->cells.end(), [](Cell c) { return cell::isMine(c); }));
+  return chunk;
+}
+
+void InfiniteBoard::insert(const ChunkRequest &request, std::shared_ptr<Chunk> chunk) {
+  const auto k{chave(request.coord)};
+  if(request.generation != m_geracao || m_pedidos.erase(k) == 0) return; //de um jogo anterior
+
+  // chunk que já tinha sido resolvido e descartado: volta resolvido, com as
+  // bombas marcadas (os contadores globais já o contaram)
+  if(m_resolvidos.erase(k) > 0)
+  {
+    for(auto &celula : chunk->cells)
+      celula |= cell::isMine(celula) ? cell::flagBit : cell::revealedBit;
+    chunk->revealedSafe = chunkArea - chunk->mines;
+  }
+  chunk->lastUse = ++m_relogio;
+  m_chunks.emplace(k, std::move(chunk));
+
+  // revelações que estavam esperando este chunk
+  if(const auto it{m_pendentes.find(k)}; it != m_pendentes.end())
+  {
+    m_fila.insert(m_fila.end(), it->second.begin(), it->second.end());
+    m_pendentes.erase(it);
+    preencher();
+  }
+}
+
+void InfiniteBoard::generateRequested() {
+  while(!m_novosPedidos.empty())
+    for(const auto &pedido : takeRequests()) insert(pedido, generate(pedido));
+}
+
+void InfiniteBoard::trim() {
+  if(m_chunks.size() <= m_config.maxChunks) return;
+
+  // só chunks resolvidos podem ser descartados sem perder estado; os menos
+  // usados recentemente saem primeiro
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> candidatos; // (último uso, chave)
+  for(const auto &[k, c] : m_chunks)
+    if(c->resolved()) candidatos.emplace_back(c->lastUse, k);
+  const auto excesso{std::min(m_chunks.size() - m_config.maxChunks, candidatos.size())};
+  std::nth_element(candidatos.begin(), candidatos.begin() + static_cast<std::ptrdiff_t>(excesso),
+                   candidatos.end());
+  for(std::size_t n = 0; n < excesso; ++n)
+  {
+    m_chunks.erase(candidatos[n].second);
+    m_resolvidos.insert(candidatos[n].second);
+  }
+}
@@ -0,0 +1,128 @@
+#ifndef INFINITEBOARD_HPP_
+#define INFINITEBOARD_HPP_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "cell.hpp"
+
+// Tabuleiro sem limites do modo "campo minado infinito". O mundo é dividido
+// em chunks de chunkSize x chunkSize células, gerados sob demanda: se uma
+// célula é uma bomba depende só de (semente, coordenadas), então cada chunk
+// pode ser gerado em qualquer ordem e em qualquer thread, sempre igual.
+//
+// O tabuleiro nunca gera chunks sozinho: pedidos de chunks que faltam são
+// retirados com takeRequests(), gerados com generate() (função pura, segura
+// para threads) e entregues com insert(). Revelações que alcançam um chunk
+// ainda não gerado ficam pendentes e continuam quando ele chega, então o
+// preenchimento atravessa as bordas dos chunks sem bloquear o quadro.
+//
+// Chunks totalmente resolvidos (todas as células seguras reveladas) são
+// descartados em ordem LRU quando há mais de maxChunks na memória; sobra só
+// a coordenada, e o chunk é regenerado já resolvido se voltar a ser visto.
+class InfiniteBoard {
+ public:
+  static constexpr int chunkShift{6};
+  static constexpr int chunkSize{1 << chunkShift};
+  static constexpr int chunkArea{chunkSize * chunkSize};
+  // abaixo desta densidade as regiões de zeros percolam e um único clique
+  // revelaria uma área infinita
+  static constexpr double minDensity{0.10};
+
+  struct Config {
+    std::uint64_t seed{};
+    double density{0.12};
+    std::int64_t startX{}; // primeiro clique: centro da zona segura
+    std::int64_t startY{};
+    int safeRadius{1};
+    std::size_t maxChunks{1024}; // chunks na memória antes de descartar os resolvidos
+  };
+
+  struct ChunkCoord {
+    std::int32_t x{};
+    std::int32_t y{};
+  };
+
+  struct Chunk {
+    std::array<Cell, chunkArea> cells{}; // linha a linha, no formato de cell.hpp
+    int mines{};
+    int revealedSafe{};
+    std::uint64_t lastUse{}; // relógio do último acesso (LRU)
+    [[nodiscard]] bool resolved() const { return revealedSafe == chunkArea - mines; }
+  };
+
+  // pedido de geração; guarda a configuração e a geração do tabuleiro para
+  // que entregas de um jogo anterior sejam descartadas
+  struct ChunkRequest {
+    ChunkCoord coord;
+    Config config;
+    std::uint64_t generation{};
+  };
+
+  InfiniteBoard() = default;
+  explicit InfiniteBoard(const Config& config) { reset(config); }
+  void reset(const Config& config); // descarta tudo e começa um jogo novo
+
+  [[nodiscard]] const Config& config() const { return m_config; }
+  [[nodiscard]] static ChunkCoord chunkOf(std::int64_t x, std::int64_t y) {
+    return {static_cast<std::int32_t>(x >> chunkShift), static_cast<std::int32_t>(y >> chunkShift)};
+  }
+
+  // chunk já gerado, ou nullptr (e o chunk é pedido)
+  const Chunk* chunk(ChunkCoord coord);
+  // estado da célula (x = coluna, y = linha), ou nada se o chunk ainda não existe
+  std::optional<Cell> cellAt(std::int64_t x, std::int64_t y);
+  // revela a célula e, se for zero, a região de zeros em volta, inclusive em
+  // chunks ainda não gerados (essa parte continua em insert())
+  void reveal(std::int64_t x, std::int64_t y);
+  bool toggleFlag(std::int64_t x, std::int64_t y); //só em chunks já gerados
+  // acorde: num número revelado com exatamente esse número de bandeiras em
+  // volta, revela as vizinhas ocultas sem bandeira (só se as 8 vizinhas já
+  // estão em chunks gerados)
+  void chord(std::int64_t x, std::int64_t y);
+
+  // geração
+  [[nodiscard]] std::vector<ChunkRequest> takeRequests(); //pedidos novos desde a última chamada
+  [[nodiscard]] static std::shared_ptr<Chunk> generate(const ChunkRequest& request);
+  void insert(const ChunkRequest& request, std::shared_ptr<Chunk> chunk);
+  void generateRequested(); //gera e entrega os pedidos na hora (uso sem interface)
+  void trim(); //descarta chunks resolvidos, do mais antigo ao mais novo, acima de maxChunks
+
+  [[nodiscard]] std::int64_t revealedSafe() const { return m_reveladasSeguras; }
+  [[nodiscard]] bool exploded() const { return m_explodiu; }
+  [[nodiscard]] std::size_t residentChunks() const { return m_chunks.size(); }
+  [[nodiscard]] std::size_t compactedChunks() const { return m_resolvidos.size(); }
+  [[nodiscard]] bool pending() const { return !m_pedidos.empty(); } //há chunks pedidos e não entregues
+
+ private:
+  using Posicao = std::pair<std::int64_t, std::int64_t>;
+
+  Config m_config;
+  std::uint64_t m_geracao{}; // incrementada a cada reset()
+  std::uint64_t m_relogio{};
+
+  std::unordered_map<std::uint64_t, std::shared_ptr<Chunk>> m_chunks;
+  std::unordered_set<std::uint64_t> m_resolvidos; // chunks resolvidos descartados
+  std::unordered_set<std::uint64_t> m_pedidos; // pedidos ainda não entregues
+  std::vector<ChunkRequest> m_novosPedidos; // ainda não retirados por takeRequests()
+  std::unordered_map<std::uint64_t, std::vector<Posicao>> m_pendentes; // revelações à espera do chunk
+  std::vector<Posicao> m_fila; // células a revelar no preenchimento
+
+  std::int64_t m_reveladasSeguras{};
+  bool m_explodiu{};
+
+  [[nodiscard]] static std::uint64_t chave(ChunkCoord coord) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.x)) << 32) |
+           static_cast<std::uint32_t>(coord.y);
+  }
+  Chunk* buscar(ChunkCoord coord); //chunk gerado (marcando o uso) ou nullptr, pedindo a geração
+  void preencher(); //esvazia m_fila
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "neighborcount.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+namespace {
+
+// Operações vetoriais sobre bytes: cada lane guarda um valor de 0 a 9, então
+// somas de 8 bits nunca transbordam
+#if defined(__AVX2__)
+#define NEIGHBORCOUNT_SIMD
+using Vec = __m256i;
+constexpr int lanes{32};
+Vec load(const std::uint8_t* p) { return _mm256_loadu_si256(reinterpret_cast<const Vec*>(p)); }
+void store(std::uint8_t* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<Vec*>(p), v); }
+Vec splat(std::uint8_t b) { return _mm256_set1_epi8(static_cast<char>(b)); }
+Vec add(Vec a, Vec b) { return _mm256_add_epi8(a, b); }
+Vec sub(Vec a, Vec b) { return _mm256_sub_epi8(a, b); }
+Vec bitAnd(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+Vec bitOr(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+// desloca 4 bits para a direita; o que vaza do byte vizinho é mascarado depois
+Vec shr4(Vec a) { return _mm256_srli_epi16(a, 4); }
+#elif defined(__SSE2__)
+#define NEIGHBORCOUNT_SIMD
+using Vec = __m128i;
+constexpr int lanes{16};
+Vec load(const std::uint8_t* p) { return _mm_loadu_si128(reinterpret_cast<const Vec*>(p)); }
+void store(std::uint8_t* p, Vec v) { _mm_storeu_si128(reinterpret_cast<Vec*>(p), v); }
+Vec splat(std::uint8_t b) { return _mm_set1_epi8(static_cast<char>(b)); }
+Vec add(Vec a, Vec b) { return _mm_add_epi8(a, b); }
+Vec sub(Vec a, Vec b) { return _mm_sub_epi8(a, b); }
+Vec bitAnd(Vec a, Vec b) { return _mm_and_si128(a, b); }
+Vec bitOr(Vec a, Vec b) { return _mm_or_si128(a, b); }
+Vec shr4(Vec a) { return _mm_srli_epi16(a, 4); }
+#elif defined(__wasm_simd128__)
+#define NEIGHBORCOUNT_SIMD
+using Vec = v128_t;
+constexpr int lanes{16};
+Vec load(const std::uint8_t* p) { return wasm_v128_load(p); }
+void store(std::uint8_t* p, Vec v) { wasm_v128_store(p, v); }
+Vec splat(std::uint8_t b) { return wasm_u8x16_splat(b); }
+Vec add(Vec a, Vec b) { return wasm_i8x16_add(a, b); }
+Vec sub(Vec a, Vec b) { return wasm_i8x16_sub(a, b); }
+Vec bitAnd(Vec a, Vec b) { return wasm_v128_and(a, b); }
+Vec bitOr(Vec a, Vec b) { return wasm_v128_or(a, b); }
+Vec shr4(Vec a) { return wasm_u8x16_shr(a, 4); }
+#endif
+
+constexpr int mineShift{4};  // posição do bit de bomba (cell::mineBit)
+static_assert(cell::mineBit == 1 << mineShift);
+
+// extrai o bit de bomba de uma linha: bombas[i] = 1 se cells[i] é bomba
+void extrairBombas(const Cell* cells, std::uint8_t* bombas, int n) {
+  int i = 0;
+#if defined(NEIGHBORCOUNT_SIMD)
+  {
+    const auto um{splat(1)};
+    for (; i + lanes <= n; i += lanes)
+      store(bombas + i, bitAnd(shr4(load(cells + i)), um));
+  }
+#endif
+  for (; i < n; ++i) bombas[i] = (cells[i] >> mineShift) & 1;
+}
+
+// soma horizontal de 3: soma[i] = bombas[i - 1] + bombas[i] + bombas[i + 1].
+// bombas aponta para o primeiro elemento útil de uma linha com um zero de
+// cada lado
+void somarLinha(const std::uint8_t* bombas, std::uint8_t* soma, int n) {
+  int i = 0;
+#if defined(NEIGHBORCOUNT_SIMD)
+  for (; i + lanes <= n; i += lanes)
+    store(soma + i, add(add(load(bombas + i - 1), load(bombas + i)),
+                        load(bombas + i + 1)));
+#endif
+  for (; i < n; ++i) soma[i] = bombas[i - 1] + bombas[i] + bombas[i + 1];
+}
+
+// soma vertical das somas horizontais, descontando a própria célula, e
+// grava o resultado nos bits de contagem
+void combinarLinhas(Cell* cells, const std::uint8_t* cima,
+                    const std::uint8_t* meio, const std::uint8_t* baixo,
+                    const std::uint8_t* bombas, int n) {
+  int i = 0;
+#if defined(NEIGHBORCOUNT_SIMD)
+  {
+    const auto manter{splat(static_cast<std::uint8_t>(~cell::countMask))};
+    for (; i + lanes <= n; i += lanes) {
+      const auto soma{sub(add(add(load(cima + i), load(meio + i)),
+                              load(baixo + i)),
+                          load(bombas + i))};
+      store(cells + i, bitOr(bitAnd(load(cells + i), manter), soma));
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    const auto soma{cima[i] + meio[i] + baixo[i] - bombas[i]};
+    cells[i] = static_cast<Cell>((cells[i] & ~cell::countMask) | soma);
+  }
+}
+
+}  // namespace
+
+void countNeighbors(Cell* cells, int width, int height, int stride) {
+  if (width <= 0 || height <= 0) return;
+
+  // três linhas de bombas (com um zero de cada lado) e três de somas
+  // horizontais, reaproveitadas em rodízio; a linha fora do tabuleiro é zero
+  const auto n{static_cast<std::size_t>(width)};
+  std::vector<std::uint8_t> buffer((n + 2) * 3 + n * 4, 0);
+  std::array<std::uint8_t*, 3> bombas{};
+  std::array<std::uint8_t*, 3> somas{};
+  for (auto k : {0, 1, 2}) {
+    bombas.at(k) = buffer.data() + (n + 2) * k + 1;
+    somas.at(k) = buffer.data() + (n + 2) * 3 + n * k;
+  }
+  const std::uint8_t* zeros{buffer.data() + (n + 2) * 3 + n * 3};
+
+  auto prepararLinha = [&](int linha, int k) {
+    extrairBombas(cells + static_cast<std::ptrdiff_t>(linha) * stride,
+                  bombas.at(k), width);
+    somarLinha(bombas.at(k), somas.at(k), width);
+  };
+
+  prepararLinha(0, 0);
+  for (int linha = 0; linha < height; ++linha) {
+    const int atual = linha % 3;
+    const int proxima = (linha + 1) % 3;
+    const int anterior = (linha + 2) % 3;
+    if (linha + 1 < height) prepararLinha(linha + 1, proxima);
+
+    combinarLinhas(cells + static_cast<std::ptrdiff_t>(linha) * stride,
+                   linha > 0 ? somas.at(anterior) : zeros, somas.at(atual),
+                   linha + 1 < height ? somas.at(proxima) : zeros,
+                   bombas.at(atual), width);
+  }
+}
+
+void countNeighborsScalar(Cell* cells, int width, int height, int stride) {
+  for (int i = 0; i < height; ++i) {
+    for (int j = 0; j < width; ++j) {
+      int soma = 0;
+      for (int di = -1; di <= 1; ++di) {
+        for (int dj = -1; dj <= 1; ++dj) {
+          const int vi = i + di;
+          const int vj = j + dj;
+          if ((di == 0 && dj == 0) || vi < 0 || vi >= height || vj < 0 ||
+              vj >= width)
+            continue;
+          if (cell::isMine(cells[vi * stride + vj])) ++soma;
+        }
+      }
+      Cell& c = cells[i * stride + j];
+      c = static_cast<Cell>((c & ~cell::countMask) | soma);
+    }
+  }
+}
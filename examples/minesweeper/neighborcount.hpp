@@ -0,0 +1,17 @@
+#ifndef NEIGHBORCOUNT_HPP_
+#define NEIGHBORCOUNT_HPP_
+
+#include "cell.hpp"
+
+// Calcula de uma vez a contagem de bombas vizinhas de todas as células,
+// a partir dos bits de bomba já marcados. Escreve os bits de contagem de cada
+// célula e preserva os demais. stride é a distância, em células, entre o
+// início de duas linhas consecutivas.
+//
+// countNeighbors usa SIMD (AVX2 ou SSE2 em builds nativos, SIMD128 no build
+// WebAssembly) quando disponível; countNeighborsScalar é a implementação de
+// referência, com o mesmo resultado.
+void countNeighbors(Cell* cells, int width, int height, int stride);
+void countNeighborsScalar(Cell* cells, int width, int height, int stride);
+
+#endif
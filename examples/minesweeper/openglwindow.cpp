@@ -2,21 +2,45 @@
 
 #include <fmt/core.h>
 #include <imgui.h>
-#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <memory>
 #include <cppitertools/itertools.hpp>
+#include <stdexcept>
+
+#include "boardfile.hpp"
+
+namespace {
+// arquivos de Game > Salvar / Carregar e dos replays, no diretório de trabalho
+const std::string arquivoSalvo{"minesweeper.sav"};
+const std::string arquivoReplay{"minesweeper.replay"};
+
+// menor número de células no lado da vista do jogador (zoom máximo)
+constexpr float menorVista{5.0f};
+// busca sem chute dentro do pool de tarefas: as auxiliares vão para o
+// próprio pool, uma por worker (a tarefa que chama é uma delas)
+void executorDoPool(std::function<void()> tarefa) { abcg::TaskPool::instance().post(std::move(tarefa)); }
+unsigned threadsDoPool() {
+  return static_cast<unsigned>(std::max<std::size_t>(abcg::TaskPool::instance().threadCount(), 1));
+}
 
-void OpenGLWindow::initializeGL() {
-  // Load a new font
-  ImGuiIO &io{ImGui::GetIO()};
-  const auto filename{getAssetsPath() + "Inconsolata-Medium.ttf"};
-  m_font = io.Fonts->AddFontFromFileTTF(filename.c_str(), 20.0);
-  if (m_font == nullptr) {
-    throw abcg::Exception{abcg::Exception::Runtime("Cannot load font file")};
-  }
+// distância, em pixels, a partir da qual um botão pressionado vira arrasto
+constexpr int limiarArrasto{4};
+
+// o mouse está sobre um widget ou há um menu aberto: o clique é do ImGui
+// (só lê o estado do último quadro)
+bool mouseNoImGui() {
+  return ImGui::IsAnyItemHovered() || ImGui::IsPopupOpen("", ImGuiPopupFlags_AnyPopup);
+}
+}  // namespace
 
+void OpenGLWindow::initializeGL() {
   // Create program to render the other objects
   m_objectsProgram = createProgramFromFile(getAssetsPath() + "objects.vert",
                                            getAssetsPath() + "objects.frag");
+  m_renderer.initialize(m_objectsProgram);
 
   abcg::glClearColor(0, 0, 0, 1);
 
@@ -28,12 +52,53 @@ void OpenGLWindow::initializeGL() {
 }
 
 void OpenGLWindow::terminateGL() {
+  for (auto &corredor : m_corredores) corredor.textura.destroy();
+  m_texturaJogador.destroy();
+  m_renderer.terminate();
   abcg::glDeleteProgram(m_objectsProgram);
 }
 
+void OpenGLWindow::resizeGL(int width, int height) {
+  m_viewportWidth = width;
+  m_viewportHeight = height;
+}
+
 void OpenGLWindow::paintGL() { 
   abcg::glClear(GL_COLOR_BUFFER_BIT); 
   abcg::glViewport(0, 0, m_viewportWidth, m_viewportHeight);
+
+  avancar_torneio();
+  // a textura do jogador só é reenviada inteira quando o tabuleiro (ou a
+  // vista do modo infinito) foi trocado; cliques enviam só os retângulos que
+  // mudaram, e um quadro sem cliques não custa nada na CPU
+  m_texturaJogador.setStreaming(m_streaming);
+  if (m_tabuleiroSujo) {
+    if (m_infinito) m_texturaJogador.upload(m_N, m_N, m_vista.data());
+    else m_texturaJogador.upload(m_board);
+    m_regioesSujas.reset(m_board.width(), m_board.height());
+    m_tabuleiroSujo = false;
+  } else if (!m_regioesSujas.empty()) {
+    m_texturaJogador.update(m_board, m_regioesSujas.take());
+  }
+
+  // as regiões estão em pixels da janela; o framebuffer pode ser maior (HiDPI)
+  // e tem a origem embaixo
+  const auto escala{ImGui::GetIO().DisplayFramebufferScale};
+  const auto alturaFramebuffer{static_cast<float>(m_viewportHeight) * escala.y};
+  for (auto k : iter::range(std::min(m_regioes.size(), m_corredores.size() + 1))) {
+    const auto &regiao{m_regioes[k]};
+    // bots ainda sem tabuleiro mostram o do jogador, todo oculto
+    const auto &textura{k == 0 || m_corredores[k - 1].textura.id() == 0 ? m_texturaJogador
+                                                                         : m_corredores[k - 1].textura};
+    const auto estado{k == 0 ? m_gameData.m_gameState : m_corredores[k - 1].estado};
+    const auto fimDeJogo{!m_infinito && (estado == GameState::Won || estado == GameState::Lost)};
+    // só o jogador tem zoom; os bots aparecem inteiros
+    m_renderer.draw(textura, static_cast<int>(regiao.x * escala.x),
+                    static_cast<int>(alturaFramebuffer - (regiao.y + regiao.altura) * escala.y),
+                    static_cast<int>(regiao.largura * escala.x), static_cast<int>(regiao.altura * escala.y),
+                    k == 0 ? m_visao : BoardView{}, fimDeJogo);
+  }
+  abcg::glViewport(0, 0, m_viewportWidth, m_viewportHeight);
 }
 
 void OpenGLWindow::paintUI() {
@@ -48,6 +113,8 @@ void OpenGLWindow::paintUI() {
     const auto flags{ImGuiWindowFlags_MenuBar | 
                      ImGuiWindowFlags_NoResize | 
                      //ImGuiWindowFlags_NoInputs | 
+                     ImGuiWindowFlags_NoScrollWithMouse | //a roda do mouse é o zoom do tabuleiro
+                     ImGuiWindowFlags_NoMove | //arrastar sobre o tabuleiro move a vista, não a janela
                      ImGuiWindowFlags_NoBackground 
                      };
     ImGui::Begin("Campo minado", nullptr, flags);
@@ -56,47 +123,138 @@ void OpenGLWindow::paintUI() {
     {
       bool restartSelected{};
       bool preencherSelected{};
+      bool dicaSelected{};
+      bool salvarSelected{};
+      bool carregarSelected{};
+      bool salvarReplaySelected{};
+      bool verReplaySelected{};
+      bool desfazerSelected{};
+      bool refazerSelected{};
       if (ImGui::BeginMenuBar()) {
         if (ImGui::BeginMenu("Game")) {
           ImGui::MenuItem("Restart", nullptr, &restartSelected);
-          ImGui::MenuItem("Preencher", nullptr, &preencherSelected);
+          // só antes do primeiro clique: preencher de novo somaria outras bombas
+          ImGui::MenuItem("Preencher", nullptr, &preencherSelected,
+                          !m_infinito && !m_gerando && m_gameData.m_gameState == GameState::Start);
+          ImGui::MenuItem("Dica", nullptr, &dicaSelected);
+          ImGui::MenuItem("Desfazer", "Ctrl+Z", &desfazerSelected, m_historico.canUndo());
+          ImGui::MenuItem("Refazer", "Ctrl+Y", &refazerSelected, m_historico.canRedo());
+          ImGui::MenuItem("Salvar", nullptr, &salvarSelected, !m_infinito && m_gameData.m_gameState != GameState::Start);
+          ImGui::MenuItem("Carregar", nullptr, &carregarSelected);
+          ImGui::MenuItem("Salvar replay", nullptr, &salvarReplaySelected, !m_replay.empty());
+          ImGui::MenuItem("Ver replay", nullptr, &verReplaySelected);
           ImGui::EndMenu();
         }
         if (ImGui::BeginMenu("Options"))
         {
             static bool enabled = true;
             ImGui::MenuItem("Enabled", "", &enabled);
-            static int n = 0;
-            ImGui::Combo("Combo", &n, "Facil (9x9)\0Medio(16x16)\0Dificil(21x21)\0\0");
-            //TODO alterar isso aqui pra funcionar
-            // switch(n)
-            // {
-            //   case 0:
-            //   m_N = 9; break;
-            //   case 1:
-            //   m_N = 16; break;
-            //   case 2:
-            //   m_N = 21; break;
-            //   default: 
-            //   m_N = 9; break;
-            // }
+            ImGui::MenuItem("Sem chute", "", &m_semChute);
+            ImGui::MenuItem("Envio por PBO", "", &m_streaming);
+            if (ImGui::MenuItem("Infinito", "", &m_infinito)) {
+              m_torneio = false;
+              restartSelected = true;
+            }
+            if (ImGui::MenuItem("Torneio", "", &m_torneio)) {
+              m_infinito = false;
+              restartSelected = true;
+            }
+            if (ImGui::SliderInt("Bots", &m_numBots, 1, 8)) restartSelected = restartSelected || m_torneio;
+            if (ImGui::Combo("Combo", &m_dificuldade, "Facil (9x9)\0Medio(16x16)\0Dificil(21x21)\0Enorme(100x100)\0Gigante(1000x1000)\0\0"))
+            {
+              switch(m_dificuldade)
+              {
+                case 0:
+                m_N = 9; break;
+                case 1:
+                m_N = 16; break;
+                case 2:
+                m_N = 21; break;
+                case 3:
+                m_N = 100; break;
+                case 4:
+                m_N = 1000; break;
+                default: 
+                m_N = 9; break;
+              }
+              restartSelected = true;
+            }
             ImGui::EndMenu();
         }
         ImGui::EndMenuBar();
       }
       if (restartSelected) restart();
-      if (preencherSelected) preencher_tabuleiro(0);
+      if (preencherSelected && !m_gerando && !m_infinito && m_gameData.m_gameState == GameState::Start)
+        preencher_tabuleiro(0);
+      if (salvarSelected) salvar();
+      if (carregarSelected) carregar();
+      if (desfazerSelected) desfazer();
+      if (refazerSelected) refazer();
+      if (salvarReplaySelected) {
+        try {
+          m_replay.save(arquivoReplay);
+          fmt::print(stdout, "{} eventos salvos em {}.\n", m_replay.events().size(), arquivoReplay);
+        } catch (const std::runtime_error &erro) {
+          fmt::print(stderr, "Erro ao salvar o replay: {}\n", erro.what());
+        }
+      }
+      if (verReplaySelected) {
+        try {
+          auto log{ReplayLog::load(arquivoReplay)};
+          // a grade do jogo é quadrada (m_N x m_N)
+          for (const auto &partida : log.games())
+            if (partida.width != partida.height)
+              throw std::runtime_error{arquivoReplay + ": partida com tabuleiro nao quadrado"};
+          m_reproducao = std::make_shared<ReplayPlayer>(std::move(log));
+          m_reproducao->setExecutor(executorDoPool, threadsDoPool());
+          m_inicioReproducao = std::chrono::steady_clock::now();
+          m_infinito = false;
+          m_torneio = false;
+          reiniciar_torneio();
+          m_gerando = false;
+          ++m_geracao;
+          m_gravando = false;
+          m_historico.clear(); //os passos são da partida substituída
+          fmt::print(stdout, "Reproduzindo {} eventos de {}.\n", m_reproducao->log().events().size(),
+                     arquivoReplay);
+        } catch (const std::runtime_error &erro) {
+          fmt::print(stderr, "Erro ao carregar o replay: {}\n", erro.what());
+        }
+      }
+      if (dicaSelected && !m_infinito && !m_torneio && !m_reproducao && m_gameData.m_gameState == GameState::Play) {
+        // revela uma célula que o solver provou ser segura, se houver; senão
+        // só informa a de menor probabilidade de bomba (a dica não chuta)
+        if (const auto segura{m_solver.nextSafe(m_board)}; segura >= 0) {
+          clicar(segura);
+        } else {
+          const auto &probabilidades{m_probability.compute(m_board, m_solver)};
+          if (const auto chute{m_probability.bestGuess(m_board)}; chute >= 0)
+            fmt::print(stdout,
+                       "Nenhuma celula comprovadamente segura. Menor risco: "
+                       "linha {}, coluna {} ({:.1f}% de bomba)\n",
+                       chute / m_N, chute % m_N,
+                       probabilidades[chute] * 100.0);
+        }
+      }
     }
     
+    if (m_reproducao) reproduzir();
+
     // Texto explicativo (ganhou/perdeu/jogando)
     std::string text;
     switch (m_gameData.m_gameState) {
       case GameState::Start:
-        text = "Clique em um quadrado para começar.";
+        text = m_gerando ? "Gerando tabuleiro sem chute..."
+                         : "Clique em um quadrado para começar.";
         break;
       case GameState::Play:
         // text = fmt::format("{} turn", m_turn ? 'X' : 'O');
-        text = "Muito bem, continue!";
+        text = m_infinito ? fmt::format("{} celulas reveladas (setas movem a vista)",
+                                        m_infinite.revealedSafe())
+               : m_reproducao && m_gerando ? "Replay: gerando tabuleiro sem chute"
+               : m_reproducao ? fmt::format("Replay: evento {} de {}", m_reproducao->position(),
+                                            m_reproducao->log().events().size())
+                              : "Muito bem, continue!";
         break;
       case GameState::Won:
         text = "Você ganhou!";
@@ -105,6 +263,8 @@ void OpenGLWindow::paintUI() {
         text = "Você perdeu!";
         break;
     }
+    if (m_torneio && m_vencedor >= 0)
+      text = m_vencedor == 0 ? "Você venceu o torneio!" : fmt::format("Bot {} venceu o torneio!", m_vencedor);
     //Centralizar texto na tela
     ImGui::SetCursorPosX(
         (appWindowWidth - ImGui::CalcTextSize(text.c_str()).x) / 2);
@@ -112,50 +272,10 @@ void OpenGLWindow::paintUI() {
     ImGui::Spacing();
     ImGui::Spacing();
 
-    // Criar tabuleiro
-    const auto gridHeight{appWindowHeight - 22 - 58 - (m_N * 10) - 58};
-    ImGui::PushFont(m_font);
-    // Pra cada linha, criar uma coluna
-    for (auto i : iter::range(m_N)) {
-      ImGui::Columns(m_N, nullptr, GL_FALSE);
-      // Pra cada coluna, criar um botão
-      for (auto j : iter::range(m_N)) {
-        auto offset{i * m_N + j}; //offset = posicao do botão atual no vetor
-        //texto pra ser colocado dentro do botão, dependendo se ele já foi clicado e se não for zero
-        std::string text = fmt::format("");
-        if(m_clicado.at(offset)){
-          if(m_bombas.at(offset) == '0')
-            text = fmt::format(".");
-          else
-            text = fmt::format("{}", m_bombas.at(offset));
-        }
-        ImGui::Button(text.c_str(), ImVec2(appWindowWidth / m_N, gridHeight / m_N));
-        
-        if (!m_clicado.at(offset)) { //esse if permite clicar só se estiver vazio
-          if (ImGui::IsItemClicked()) {
-            if (m_gameData.m_gameState == GameState::Start)
-            {
-              fmt::print(stdout, "Primeira celula clicada: {}X{}.\n", i, j);
-              preencher_tabuleiro(offset);
-            }
-            if (m_gameData.m_gameState == GameState::Play)
-            {
-              fmt::print(stdout, "Clicado na celula {}X{}.\n", i, j);
-              m_clicado.at(offset) = true; //revelado o que está ocultado
-              checkBoard(); //decidir se perdeu ou ganhou
-              if(m_bombas.at(offset) == '0')
-              {
-                fmt::print(stdout, "Celula {}X{} eh zero.\n", i, j);
-                clicar_nos_vizinhos(offset);
-              }
-            }
-          }
-        }
-        ImGui::NextColumn();
-      }
-    }
-    ImGui::Columns(1); //coluna do botão de restart
-    ImGui::PopFont(); //se tirar quebra
+    // Criar tabuleiro: só as regiões e os cliques, as células são desenhadas
+    // em paintGL (o espaço de baixo fica para o botão de restart)
+    tabuleiros(appWindowHeight - ImGui::GetCursorPosY() - 70);
+    if (m_infinito) carregar_chunks(); //pedidos feitos pela vista montada acima
     //faz um espacinho pra separar o botão de restart
     ImGui::Spacing(); 
     ImGui::Spacing();
@@ -174,201 +294,595 @@ void OpenGLWindow::paintUI() {
 void OpenGLWindow::checkBoard() {
   if (m_gameData.m_gameState != GameState::Play) return; //se ganhou ou perdeu, manter a tela igual
 
-  int contadas = 0;
-  // checar nas linhas e colunas se tem uma bomba clicada
-  for (const auto i : iter::range(m_N)) {
-    for (const auto j : iter::range(m_N)) {
-      const auto offset{i * m_N + j};
-      if(m_clicado.at(offset)){
-        contadas++;
-        if(m_bombas.at(offset) == 'X')
-        {
-          fmt::print(stdout, "Bomba clicada em {}X{}.\n", i, j);
-          m_gameData.m_gameState = GameState::Lost;
-          m_clicado.fill(true); //revelar
-          return; //não continuar pra checar se ganhou
-        }
-      }
-    }
+  // o tabuleiro mantém os contadores atualizados a cada revelação, então não
+  // é preciso percorrer todas as células
+  if(m_board.exploded())
+  {
+    fmt::print(stdout, "Bomba clicada.\n");
+    m_gameData.m_gameState = GameState::Lost; //o tabuleiro inteiro é mostrado, mas não revelado: dá para desfazer
   }
-
-  // checar se o jogador ganhou
-  if(contadas == m_N * m_N - bombas)
+  else if(m_board.cleared())
   {
-     m_gameData.m_gameState = GameState::Won;
-     m_clicado.fill(true); //revelar
+    m_gameData.m_gameState = GameState::Won;
   }
 }
 
 void OpenGLWindow::preencher_tabuleiro(int clicada)
 {
-  fmt::print(stdout, "Gerar {} bombas.\n", bombas);
+  fmt::print(stdout, "Gerar {} bombas com semente {}.\n", m_board.mines(), m_seed);
+  // a partida entra no registro quando o tabuleiro é gerado, com tudo o que
+  // é preciso para gerá-lo de novo
+  m_replay.restart(tempoReplay(), {m_N, m_N, m_board.mines(), m_seed, m_zonaSegura, m_semChute, clicada});
+  m_gravando = true;
+  if(m_semChute)
+  {
+    // a busca roda no pool de tarefas, fora do quadro, e os candidatos
+    // também: as auxiliares são tarefas do mesmo pool, não threads novas. O
+    // tabuleiro só é trocado no callback, já na thread principal
+    m_gerando = true;
+    const auto geracao{++m_geracao};
+    auto tabuleiro{std::make_shared<Board>(m_board)};
+    abcg::TaskPool::instance()
+        .submit([tabuleiro, clicada, seed = m_seed, raio = m_zonaSegura] {
+          return fillNoGuess(*tabuleiro, clicada, seed, raio, 10000, threadsDoPool(), executorDoPool);
+        })
+        .thenOnMainThread([this, tabuleiro, clicada, geracao](const NoGuessResult &resultado) {
+          if(geracao != m_geracao) return; //o jogo foi reiniciado durante a busca
+          m_gerando = false;
+          if(resultado.candidate >= 0)
+            fmt::print(stdout, "Tabuleiro sem chute: candidato {} ({} testados).\n",
+                       resultado.candidate, resultado.tested);
+          else
+            fmt::print(stdout, "Nenhum tabuleiro sem chute entre {} candidatos.\n",
+                       resultado.tested);
+          m_board = *tabuleiro;
+          m_tabuleiroSujo = true;
+          m_solver.reset(m_board);
+          m_gameData.m_gameState = GameState::Play;
+          iniciar_torneio(clicada);
+          clicar(clicada); //o clique que iniciou a geração
+        });
+    return;
+  }
+  m_board.fill(clicada, m_seed, m_zonaSegura);
+  m_tabuleiroSujo = true;
+  m_solver.reset(m_board);
+  m_gameData.m_gameState = GameState::Play;
+  iniciar_torneio(clicada);
+}
 
-  int i = 0; //número de bombas já colocadas
-  while(i < bombas){
-    // Iniciar gerador de números aleatórios
-    m_randomEngine.seed(std::chrono::steady_clock::now().time_since_epoch().count());
+void OpenGLWindow::jogar_infinito(int i, int j, Acao acao)
+{
+  const auto x{m_cameraX + j};
+  const auto y{m_cameraY + i};
+  // antes do primeiro clique o mundo ainda não existe
+  std::optional<Cell> c;
+  if (m_gameData.m_gameState != GameState::Start) c = m_infinite.cellAt(x, y);
+  if (acao != Acao::Nenhuma) m_tabuleiroSujo = true;
+  if (m_gameData.m_gameState == GameState::Play && acao == Acao::Bandeira) m_infinite.toggleFlag(x, y);
+  if (m_gameData.m_gameState == GameState::Play && acao == Acao::Acorde) m_infinite.chord(x, y);
+  if (acao != Acao::Revelar || (c && cell::isRevealed(*c))) return;
+
+  if (m_gameData.m_gameState == GameState::Start)
+  {
+    fmt::print(stdout, "Primeira celula clicada: {}X{}, semente {}.\n", y, x, m_seed);
+    InfiniteBoard::Config config;
+    config.seed = m_seed;
+    config.startX = x;
+    config.startY = y;
+    config.safeRadius = m_zonaSegura;
+    m_infinite.reset(config);
+    m_gameData.m_gameState = GameState::Play;
+  }
+  if (m_gameData.m_gameState == GameState::Play)
+    m_infinite.reveal(x, y); //o fim de jogo é checado em carregar_chunks()
+}
 
-    // Pegar uma célula aleatória (de zero a m_N^2 - 1)
-    std::uniform_real_distribution<float> realDistribution(0.0f, m_N * m_N - 1.0f);
-    const int offset = floor(realDistribution(m_randomEngine));
-    fmt::print(stdout, "Sorteada posicao {}.\n", offset);
+void OpenGLWindow::montar_vista()
+{
+  // a vista m_N x m_N a partir da câmera, com a moldura, copiada faixa a
+  // faixa de cada chunk: um acesso ao mapa por chunk, não por célula. Células
+  // de chunks ainda não gerados ficam com borderBit, que o shader desenha
+  // como pendentes; antes do primeiro clique tudo fica oculto
+  const auto lado{m_N + 2};
+  m_vista.assign(static_cast<std::size_t>(lado) * lado, cell::borderBit | cell::revealedBit);
+  const bool iniciado{m_gameData.m_gameState != GameState::Start};
+  for (auto i : iter::range(m_N)) {
+    auto *linha{m_vista.data() + static_cast<std::ptrdiff_t>(i + 1) * lado + 1};
+    if (!iniciado) {
+      std::fill_n(linha, m_N, Cell{});
+      continue;
+    }
+    const auto y{m_cameraY + i};
+    for (int j = 0; j < m_N;) {
+      const auto x{m_cameraX + j};
+      const auto dentro{static_cast<int>(x & (InfiniteBoard::chunkSize - 1))};
+      const auto n{std::min(m_N - j, InfiniteBoard::chunkSize - dentro)};
+      if (const auto *chunk{m_infinite.chunk(InfiniteBoard::chunkOf(x, y))}; chunk != nullptr) {
+        const auto inicio{(y & (InfiniteBoard::chunkSize - 1)) * InfiniteBoard::chunkSize + dentro};
+        std::copy_n(chunk->cells.begin() + inicio, n, linha + j);
+      } else {
+        std::fill_n(linha + j, n, cell::borderBit);
+      }
+      j += n;
+    }
+  }
+}
 
-    //Preencher essa célula com uma bomba, se  não for a clicada e se já não for uma bomba
-    if(offset != clicada && m_bombas.at(offset) != 'X')
-    {
-      m_bombas.at(offset) = 'X';
-      i++;
-      fmt::print(stdout, "Bomba colocada na posicao {}.\n", offset);
-      fmt::print(stdout, "Agora existem {} bombas.\n", i);
+void OpenGLWindow::carregar_chunks()
+{
+  // cada chunk é gerado no pool de tarefas e entregue na thread principal,
+  // onde também continuam as revelações que esperavam por ele
+  for (const auto &pedido : m_infinite.takeRequests())
+  {
+    abcg::TaskPool::instance()
+        .submit([pedido] { return InfiniteBoard::generate(pedido); })
+        .thenOnMainThread([this, pedido](const std::shared_ptr<InfiniteBoard::Chunk> &chunk) {
+          m_infinite.insert(pedido, chunk);
+          m_tabuleiroSujo = true;
+        });
+  }
+  m_infinite.trim();
+
+  if (m_gameData.m_gameState == GameState::Play && m_infinite.exploded())
+  {
+    fmt::print(stdout, "Bomba clicada com {} celulas reveladas.\n", m_infinite.revealedSafe());
+    m_gameData.m_gameState = GameState::Lost;
+  }
+}
 
-      //Pra cada vizinho, somar 1 ao número, mas só se esse vizinho não for uma bomba
-      somar_vizinhos(offset);
+void OpenGLWindow::jogar(int offset, Acao acao)
+{
+  const auto i{offset / m_N};
+  const auto j{offset % m_N};
+  if (acao == Acao::Revelar && !m_board.isRevealed(offset)) { //esse if permite clicar só se estiver vazio
+    if (m_gameData.m_gameState == GameState::Start && !m_gerando)
+    {
+      fmt::print(stdout, "Primeira celula clicada: {}X{}.\n", i, j);
+      preencher_tabuleiro(offset);
     }
-    else
+    if (m_gameData.m_gameState == GameState::Play)
     {
-      fmt::print(stdout, "Celula {} foi a clicada ou ja possuia bomba.\n", offset);
+      fmt::print(stdout, "Clicado na celula {}X{}.\n", i, j);
+      clicar(offset);
     }
   }
-  m_gameData.m_gameState = GameState::Play;
+  if (acao == Acao::Bandeira && m_gameData.m_gameState == GameState::Play) bandeira(offset);
+  if (acao == Acao::Acorde && m_gameData.m_gameState == GameState::Play) acorde(offset);
 }
 
-bool OpenGLWindow::isVizinho(int n, int v)
+void OpenGLWindow::clicar(int offset)
 {
-  //regras que fazem de v um não-vizinho de n
-  if(  v < 0
-    || v >= m_N * m_N
-    || (n % m_N == 0 && v % m_N == m_N - 1)
-    || (n % m_N == m_N - 1 && v % m_N == 0)
-  )
-    return false;
-  return true;
+  if (m_gravando) m_replay.reveal(tempoReplay(), offset);
+  const auto &reveladas{m_board.reveal(offset)}; //revelado o que está ocultado (e os vizinhos, se for zero)
+  if (!m_tabuleiroSujo) m_regioesSujas.mark(reveladas); //só os retângulos alterados vão para a GPU
+  m_historico.recordReveal(reveladas); //só as células que mudaram
+  m_solver.update(m_board, reveladas); //o solver só reexamina o que mudou
+  checkBoard(); //decidir se perdeu ou ganhou
 }
 
-void OpenGLWindow::somar_vizinhos(int n)
+void OpenGLWindow::salvar()
 {
-  int v = n - m_N - 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
-  
-  v = n - m_N;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
-
-  v = n - m_N + 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+  try
+  {
+    saveBoard(arquivoSalvo, m_board, m_seed);
+    fmt::print(stdout, "Partida salva em {}.\n", arquivoSalvo);
+  }
+  catch (const std::runtime_error &erro)
+  {
+    fmt::print(stderr, "Erro ao salvar: {}\n", erro.what());
+  }
+}
 
-  v = n - 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+void OpenGLWindow::carregar()
+{
+  // carrega num tabuleiro à parte: um arquivo inválido não estraga a partida atual
+  Board tabuleiro;
+  std::uint64_t semente{};
+  try
+  {
+    semente = loadBoard(arquivoSalvo, tabuleiro);
+  }
+  catch (const std::runtime_error &erro)
+  {
+    fmt::print(stderr, "Erro ao carregar: {}\n", erro.what());
+    return;
+  }
+  if (tabuleiro.width() != tabuleiro.height())
+  {
+    fmt::print(stderr, "Erro ao carregar: o tabuleiro precisa ser quadrado.\n");
+    return;
+  }
 
-  v = n + 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+  m_infinito = false;
+  m_torneio = false;
+  reiniciar_torneio();
+  m_N = tabuleiro.width();
+  m_dificuldade = m_N == 1000 ? 4 : m_N == 100 ? 3 : m_N == 21 ? 2 : m_N == 16 ? 1 : 0;
+  m_gerando = false;
+  ++m_geracao; //descarta uma geração sem chute ainda em andamento
+  m_board = std::move(tabuleiro);
+  m_tabuleiroSujo = true;
+  m_seed = semente;
+  m_reproducao.reset();
+  m_historico.clear();
+  m_gravando = false; //o registro não tem como recriar uma partida carregada
+  m_solver.reset(m_board);
+  m_gameData.m_gameState = GameState::Play;
+  checkBoard(); //partida salva depois do fim de jogo
+  fmt::print(stdout, "Partida carregada de {} (semente {}).\n", arquivoSalvo, m_seed);
+}
 
-  v = n + m_N - 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+void OpenGLWindow::desfazer()
+{
+  if (m_infinito || m_torneio || m_reproducao || m_gameData.m_gameState == GameState::Start) return;
+  if (!m_historico.undo(m_board)) return;
+  m_tabuleiroSujo = true;
+  if (m_gravando) m_replay.undo(tempoReplay());
+  m_solver.reset(m_board); //o solver só sabe avançar: recomeça do tabuleiro visível
+  m_gameData.m_gameState = GameState::Play; //desfazer o clique na bomba volta ao jogo
+  checkBoard();
+}
 
-  v = n + m_N;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+void OpenGLWindow::refazer()
+{
+  if (m_infinito || m_torneio || m_reproducao || m_gameData.m_gameState == GameState::Start) return;
+  if (!m_historico.redo(m_board)) return;
+  m_tabuleiroSujo = true;
+  if (m_gravando) m_replay.redo(tempoReplay());
+  m_solver.reset(m_board);
+  m_gameData.m_gameState = GameState::Play;
+  checkBoard();
+}
 
-  v = n + m_N + 1;
-  if(isVizinho(n, v) && m_bombas.at(v) != 'X')
-    m_bombas.at(v) = m_bombas.at(v) + 1;
+std::uint64_t OpenGLWindow::tempoReplay() const
+{
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - m_inicioReplay)
+                                        .count());
 }
 
-void OpenGLWindow::clicar_nos_vizinhos(int n)
+void OpenGLWindow::reproduzir()
 {
-  fmt::print(stdout, "Clicado nos vizinhos da celula {}.\n", n);
-  int v = n - m_N - 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
+  if (m_gerando) return; //o tabuleiro de um Restart ainda está sendo gerado no pool
+
+  // aplica os eventos cujo instante já passou, então cada evento aparece no
+  // mesmo quadro (relativo ao início) em que foi gravado
+  const auto agora{static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - m_inicioReproducao).count())};
+  bool mudou{false};
+  for (const auto *evento{m_reproducao->next()}; evento != nullptr && evento->time <= agora;
+       evento = m_reproducao->next())
   {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+    // um tabuleiro sem chute é gerado no pool, como no jogo; a reprodução
+    // espera por ele sem travar o quadro
+    if (evento->type == ReplayEvent::Type::Restart && m_reproducao->log().games()[evento->offset].noGuess)
+    {
+      m_gerando = true;
+      abcg::TaskPool::instance()
+          .submit([reproducao = m_reproducao] { return reproducao->step(); })
+          .thenOnMainThread([this, geracao = ++m_geracao](bool) {
+            if (geracao != m_geracao) return; //replay trocado ou jogo reiniciado durante a geração
+            m_gerando = false;
+            mostrar_reproducao();
+          });
+      break;
+    }
+    m_reproducao->step();
+    mudou = true;
   }
-
-  v = n - m_N;
-  if(isVizinho(n, v) && !m_clicado.at(v))
+  if (mudou) mostrar_reproducao();
+  if (!m_gerando && m_reproducao->finished())
   {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+    fmt::print(stdout, "Fim do replay.\n");
+    m_reproducao.reset();
+    m_historico.clear(); //o tabuleiro agora é o do replay, sem passos para desfazer
+    m_solver.reset(m_board);
   }
+}
 
-  v = n - m_N + 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
-  }
+void OpenGLWindow::mostrar_reproducao()
+{
+  if (!m_reproducao->started()) return;
+  m_board = m_reproducao->board();
+  m_tabuleiroSujo = true;
+  m_N = m_board.width();
+  m_gameData.m_gameState = GameState::Play;
+  checkBoard();
+}
 
-  v = n - 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+void OpenGLWindow::bandeira(int offset)
+{
+  if (!m_board.toggleFlag(offset)) return; //célula já revelada
+  if (!m_tabuleiroSujo) m_regioesSujas.mark(offset);
+  m_historico.recordFlag(offset);
+  if (m_gravando) m_replay.flag(tempoReplay(), offset);
+}
+
+void OpenGLWindow::acorde(int offset)
+{
+  // todas as vizinhas e seus preenchimentos numa única revelação: um passo
+  // de desfazer e uma atualização do solver
+  const auto &reveladas{m_board.chord(offset)};
+  if (reveladas.empty()) return; //não é um número com todas as bandeiras postas
+  if (!m_tabuleiroSujo) m_regioesSujas.mark(reveladas);
+  if (m_gravando) m_replay.chord(tempoReplay(), offset);
+  m_historico.recordReveal(reveladas);
+  m_solver.update(m_board, reveladas);
+  checkBoard();
+}
+
+//função para reiniciar o jogo para as configurações iniciais
+void OpenGLWindow::restart() {
+  m_gameData.m_gameState = GameState::Start;
+  m_reproducao.reset();
+  m_historico.clear();
+  m_gravando = false;
+  m_gerando = false;
+  ++m_geracao; //descarta uma geração sem chute ainda em andamento
+  //define o número de bombas como 12% do tabuleiro, arredondado pra cima
+  const auto bombas{static_cast<int>(std::ceil(m_N * m_N * 0.12f))};
+  m_board.reset(m_N, m_N, bombas);
+  m_tabuleiroSujo = true;
+  m_cameraX = -(m_N / 2); //modo infinito: vista centrada na origem
+  m_cameraY = -(m_N / 2);
+  m_replay.clear(); //o registro é só da partida nova, com o relógio a partir daqui
+  m_inicioReplay = std::chrono::steady_clock::now();
+  m_visao = {}; //o tabuleiro novo aparece inteiro
+  enquadrar();
+  m_seed = (static_cast<std::uint64_t>(m_randomDevice()) << 32) | m_randomDevice();
+  reiniciar_torneio();
+  fmt::print(stdout, "Jogo reiniciado.\n");
+}
+
+void OpenGLWindow::reiniciar_torneio()
+{
+  ++m_geracaoTorneio; //jogadas ainda no pool são descartadas ao chegar
+  m_vencedor = -1;
+  for (auto &corredor : m_corredores) corredor.textura.destroy();
+  m_corredores.clear();
+  if (!m_torneio) return;
+  // cada bot joga num ritmo: o primeiro é o mais lento
+  for (auto i : iter::range(m_numBots)) {
+    auto &corredor{m_corredores.emplace_back()};
+    corredor.bot = std::make_shared<Bot>();
+    corredor.intervalo = 0.25 + 0.5 / (i + 1);
   }
+}
 
-  v = n + 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+void OpenGLWindow::iniciar_torneio(int clicada)
+{
+  if (!m_torneio) return;
+  // todos correm no mesmo tabuleiro, a partir do mesmo primeiro clique
+  m_inicioTorneio = std::chrono::steady_clock::now();
+  for (auto &corredor : m_corredores) {
+    corredor.bot->start(m_board, clicada);
+    corredor.estado = GameState::Play;
+    corredor.sujo = true;
+    corredor.proxima = m_inicioTorneio;
   }
+}
 
-  v = n + m_N - 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+void OpenGLWindow::tabuleiros(float altura)
+{
+  if (m_infinito && m_tabuleiroSujo) montar_vista();
+
+  // grade com o jogador e os bots (só o jogador fora do torneio), cada
+  // tabuleiro quadrado e centrado na sua célula da grade, com uma linha para
+  // o placar em cima
+  const auto origem{ImGui::GetCursorScreenPos()};
+  const auto largura{ImGui::GetContentRegionAvail().x};
+  const auto total{static_cast<int>(m_corredores.size()) + 1};
+  const auto colunas{static_cast<int>(std::ceil(std::sqrt(total)))};
+  const auto linhas{(total + colunas - 1) / colunas};
+  const auto larguraCelula{largura / colunas};
+  const auto alturaCelula{altura / linhas};
+  const auto placar{m_torneio ? ImGui::GetTextLineHeightWithSpacing() : 0.0f};
+  const auto lado{std::max(0.0f, std::min(larguraCelula, alturaCelula - placar) - 6)};
+
+  m_regioes.resize(total);
+  auto *desenho{ImGui::GetWindowDrawList()};
+  for (auto k : iter::range(total)) {
+    auto &regiao{m_regioes[k]};
+    regiao.x = origem.x + (k % colunas) * larguraCelula + (larguraCelula - lado) / 2;
+    regiao.y = origem.y + (k / colunas) * alturaCelula + placar;
+    regiao.largura = lado;
+    regiao.altura = lado;
+    if (!m_torneio) continue;
+
+    std::string nome;
+    if (k == 0) {
+      const auto seguras{m_board.size() - m_board.mines()};
+      nome = fmt::format("Voce {}%", seguras > 0 ? 100 * m_board.revealedSafe() / seguras : 0);
+    } else {
+      const auto &corredor{m_corredores[k - 1]};
+      const auto seguras{m_board.size() - m_board.mines()}; //o tabuleiro é o mesmo do jogador
+      nome = fmt::format("Bot {} {}%{}", k, seguras > 0 ? 100 * corredor.progresso / seguras : 0,
+                         corredor.estado == GameState::Lost ? " (explodiu)" : "");
+    }
+    desenho->AddText(ImVec2(regiao.x, regiao.y - placar), k == m_vencedor ? IM_COL32(255, 220, 0, 255)
+                                                                             : IM_COL32(255, 255, 255, 255),
+                     nome.c_str());
   }
 
-  v = n + m_N;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+  // o mouse sobre o tabuleiro do jogador é tratado em handleEvent, pelas
+  // regiões calculadas aqui
+  enquadrar();
+  if (m_vencedor < 0 && m_gameData.m_gameState == GameState::Won) {
+    m_vencedor = 0;
+    fmt::print(stdout, "Jogador venceu o torneio em {:.1f} s.\n",
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - m_inicioTorneio).count());
   }
+  ImGui::SetCursorScreenPos(ImVec2(origem.x, origem.y + altura));
+}
 
-  v = n + m_N + 1;
-  if(isVizinho(n, v) && !m_clicado.at(v))
-  {
-    m_clicado.at(v) = true;
-    if(m_bombas.at(v) == '0')
-      clicar_nos_vizinhos(v);
+void OpenGLWindow::enquadrar()
+{
+  // sem zoom a vista é o tabuleiro inteiro
+  const auto n{static_cast<float>(m_N)};
+  m_visao.span = m_visao.span <= 0 ? n : std::clamp(m_visao.span, std::min(n, menorVista), n);
+  m_visao.x = std::clamp(m_visao.x, 0.0f, n - m_visao.span);
+  m_visao.y = std::clamp(m_visao.y, 0.0f, n - m_visao.span);
+}
+
+void OpenGLWindow::mover_visao(float dx, float dy)
+{
+  if (!m_infinito) {
+    m_visao.x += dx;
+    m_visao.y += dy;
+    enquadrar();
+    return;
   }
+  // no modo infinito o mundo anda sob a vista, uma célula inteira por vez
+  m_arrasteX += dx;
+  m_arrasteY += dy;
+  const auto celulasX{static_cast<std::int64_t>(m_arrasteX)};
+  const auto celulasY{static_cast<std::int64_t>(m_arrasteY)};
+  if (celulasX == 0 && celulasY == 0) return;
+  m_cameraX += celulasX;
+  m_cameraY += celulasY;
+  m_arrasteX -= static_cast<float>(celulasX);
+  m_arrasteY -= static_cast<float>(celulasY);
+  m_tabuleiroSujo = true;
 }
 
-//função para reiniciar o jogo para as configurações iniciais
-void OpenGLWindow::restart() {
-  m_gameData.m_gameState = GameState::Start;
-  m_bombas.fill('0');
-  m_clicado.fill(false);
-  fmt::print(stdout, "Jogo reiniciado.\n");
+void OpenGLWindow::ampliar(float passos, int x, int y)
+{
+  // o ponto sob o cursor continua sob o cursor
+  const auto &jogador{m_regioes[0]};
+  const auto antes{m_visao.span};
+  m_visao.span *= std::pow(0.85f, passos);
+  enquadrar();
+  const auto fator{(antes - m_visao.span) / jogador.largura};
+  m_visao.x += (static_cast<float>(x) - jogador.x) * fator;
+  m_visao.y += (static_cast<float>(y) - jogador.y) * fator;
+  enquadrar();
+}
+
+std::optional<std::pair<int, int>> OpenGLWindow::celula_na_posicao(int x, int y) const
+{
+  if (m_regioes.empty() || m_regioes[0].largura <= 0) return std::nullopt;
+  const auto &jogador{m_regioes[0]};
+  const auto px{(static_cast<float>(x) - jogador.x) / jogador.largura};
+  const auto py{(static_cast<float>(y) - jogador.y) / jogador.altura};
+  if (px < 0 || px >= 1 || py < 0 || py >= 1) return std::nullopt;
+  const auto i{static_cast<int>(m_visao.y + py * m_visao.span)};
+  const auto j{static_cast<int>(m_visao.x + px * m_visao.span)};
+  return std::pair{std::min(i, m_N - 1), std::min(j, m_N - 1)};
+}
+
+void OpenGLWindow::avancar_torneio()
+{
+  const auto agora{std::chrono::steady_clock::now()};
+  for (auto i : iter::range(m_corredores.size())) {
+    auto &corredor{m_corredores[i]};
+    if (corredor.ocupado) continue;
+    // a textura só é atualizada entre duas jogadas, com o bot parado
+    corredor.textura.setStreaming(m_streaming);
+    if (corredor.sujo) {
+      corredor.textura.upload(corredor.bot->board());
+      corredor.regioes.reset(corredor.bot->board().width(), corredor.bot->board().height());
+      corredor.sujo = false;
+    } else if (!corredor.regioes.empty()) {
+      corredor.textura.update(corredor.bot->board(), corredor.regioes.take());
+    }
+    if (corredor.estado != GameState::Play || agora < corredor.proxima) continue;
+
+    corredor.ocupado = true;
+    abcg::TaskPool::instance()
+        .submit([bot = corredor.bot] { return bot->step().size(); })
+        .thenOnMainThread([this, i, geracao = m_geracaoTorneio](std::size_t) {
+          if (geracao != m_geracaoTorneio) return; //torneio reiniciado durante a jogada
+          auto &c{m_corredores[i]};
+          const auto &tabuleiro{c.bot->board()};
+          c.ocupado = false;
+          if (!c.sujo) c.regioes.mark(c.bot->lastStep());
+          c.progresso = tabuleiro.revealedSafe();
+          c.proxima = std::chrono::steady_clock::now() +
+                      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                          std::chrono::duration<double>(c.intervalo));
+          if (tabuleiro.exploded()) {
+            c.estado = GameState::Lost;
+            fmt::print(stdout, "Bot {} explodiu apos {} jogadas ({} chutes).\n", i + 1,
+                       c.bot->moves(), c.bot->guesses());
+          } else if (tabuleiro.cleared()) {
+            c.estado = GameState::Won;
+            const auto tempo{std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                           m_inicioTorneio)};
+            fmt::print(stdout, "Bot {} terminou em {:.1f} s ({} jogadas, {} chutes).\n", i + 1,
+                       tempo.count(), c.bot->moves(), c.bot->guesses());
+            if (m_vencedor < 0) m_vencedor = static_cast<int>(i) + 1;
+          }
+        });
+  }
 }
 
 // eventos de input
 void OpenGLWindow::handleEvent(SDL_Event &event) {
-  // Mouse events
-   if (event.type == SDL_MOUSEBUTTONDOWN) {
+  // Mouse events: os botões vão para m_input, e no tabuleiro do jogador a
+  // célula sai direto das coordenadas do evento (ver celula_na_posicao). Um
+  // botão que arrasta move a vista em vez de clicar, então a ação sai quando
+  // o botão é solto
+  if (event.type == SDL_MOUSEBUTTONDOWN) {
     if (event.button.button == SDL_BUTTON_LEFT)
       m_gameData.m_input.set(static_cast<size_t>(Input::Left));
     if (event.button.button == SDL_BUTTON_RIGHT)
       m_gameData.m_input.set(static_cast<size_t>(Input::Right));
+    if (!m_pressionado && !mouseNoImGui() && celula_na_posicao(event.button.x, event.button.y)) {
+      m_pressionado = true;
+      m_pressaoX = event.button.x;
+      m_pressaoY = event.button.y;
+    }
+    if (m_pressionado && (m_gameData.m_input.all() || event.button.button == SDL_BUTTON_MIDDLE))
+      m_acordeArmado = true;
+  }
+  if (event.type == SDL_MOUSEMOTION) {
+    m_mouseX = event.motion.x;
+    m_mouseY = event.motion.y;
+    if (m_pressionado && !m_arrastando)
+      m_arrastando = std::max(std::abs(m_mouseX - m_pressaoX), std::abs(m_mouseY - m_pressaoY)) > limiarArrasto;
+    if (m_arrastando) {
+      const auto celulasPorPixel{m_visao.span / m_regioes[0].largura};
+      mover_visao(static_cast<float>(-event.motion.xrel) * celulasPorPixel,
+                  static_cast<float>(-event.motion.yrel) * celulasPorPixel);
+    }
+  }
+  // a roda do mouse sobre o tabuleiro é o zoom
+  if (event.type == SDL_MOUSEWHEEL && !mouseNoImGui() && celula_na_posicao(m_mouseX, m_mouseY))
+    ampliar(static_cast<float>(event.wheel.y), m_mouseX, m_mouseY);
+  // Ctrl+Z / Ctrl+Y desfazem e refazem
+  if (event.type == SDL_KEYDOWN && (event.key.keysym.mod & KMOD_CTRL) != 0) {
+    if (event.key.keysym.sym == SDLK_z) desfazer();
+    if (event.key.keysym.sym == SDLK_y) refazer();
+  }
+  // setas movem a vista do modo infinito
+  if (event.type == SDL_KEYDOWN && m_infinito) {
+    if (event.key.keysym.sym == SDLK_LEFT) --m_cameraX;
+    if (event.key.keysym.sym == SDLK_RIGHT) ++m_cameraX;
+    if (event.key.keysym.sym == SDLK_UP) --m_cameraY;
+    if (event.key.keysym.sym == SDLK_DOWN) ++m_cameraY;
+    m_tabuleiroSujo = true;
   }
   if (event.type == SDL_MOUSEBUTTONUP) {
+    // a primeira soltura decide: acorde se os dois botões (ou o do meio)
+    // foram pressionados juntos, senão o botão solto; a segunda soltura de
+    // um acorde já não acha nada pressionado (durante um replay não se clica)
+    if (m_pressionado && !m_arrastando && !m_reproducao) {
+      const auto acao{m_acordeArmado                                 ? Acao::Acorde
+                      : event.button.button == SDL_BUTTON_RIGHT ? Acao::Bandeira
+                                                                : Acao::Revelar};
+      if (const auto celula{celula_na_posicao(event.button.x, event.button.y)}) {
+        const auto [i, j]{*celula};
+        if (m_infinito) jogar_infinito(i, j, acao);
+        else jogar(i * m_N + j, acao);
+      }
+    }
+    m_pressionado = false;
+    m_arrastando = false;
+    m_acordeArmado = false;
     if (event.button.button == SDL_BUTTON_LEFT)
       m_gameData.m_input.reset(static_cast<size_t>(Input::Left));
     if (event.button.button == SDL_BUTTON_RIGHT)
       m_gameData.m_input.reset(static_cast<size_t>(Input::Right));
   }
-}
\ No newline at end of file
+}
@@ -3,10 +3,24 @@
 
 #include <imgui.h>
 
-#include <array>
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <random>
+#include <utility>
+#include <vector>
 #include "abcg.hpp"
+#include "board.hpp"
+#include "boardrenderer.hpp"
+#include "bot.hpp"
+#include "dirtyregions.hpp"
 #include "gamedata.hpp"
+#include "generator.hpp"
+#include "history.hpp"
+#include "infiniteboard.hpp"
+#include "probability.hpp"
+#include "replay.hpp"
+#include "solver.hpp"
 
 class OpenGLWindow : public abcg::OpenGLWindow {
  protected:
@@ -14,33 +28,114 @@ class OpenGLWindow : public abcg::OpenGLWindow {
   void initializeGL() override;
   void paintGL() override;
   void paintUI() override;
+  void resizeGL(int width, int height) override;
   void terminateGL() override;
 
  private:
   GLuint m_objectsProgram{};
+  BoardRenderer m_renderer; // desenha todos os tabuleiros com m_objectsProgram (ver boardrenderer.hpp)
+  BoardTexture m_texturaJogador;
+  bool m_tabuleiroSujo{true}; // m_board ou a vista infinita foi trocado: a textura é reenviada inteira
+  DirtyRegions m_regioesSujas; // células de m_board alteradas desde o último envio
+  bool m_streaming{false}; // envia as regiões alteradas por um anel de pixel buffers
+  struct Regiao {
+    float x{}, y{}, largura{}, altura{}; // em pixels da janela, origem no canto superior esquerdo
+  };
+  std::vector<Regiao> m_regioes; // [0] é o jogador e [i + 1] o m_corredores[i]; calculadas em paintUI
+  BoardView m_visao; // parte do tabuleiro do jogador na região: zoom e deslocamento
+  // mouse sobre o tabuleiro do jogador, tratado direto em handleEvent
+  bool m_pressionado{false}; // um botão foi pressionado sobre o tabuleiro e ainda não foi solto
+  bool m_arrastando{false}; // o botão pressionado arrastou a vista: não é clique
+  bool m_acordeArmado{false}; // os dois botões (ou o do meio) foram pressionados juntos
+  int m_pressaoX{}; // onde o botão foi pressionado, em pixels da janela
+  int m_pressaoY{};
+  int m_mouseX{}; // última posição do mouse (os eventos da roda não a trazem)
+  int m_mouseY{};
+  float m_arrasteX{}; // fração de célula arrastada e ainda não aplicada à câmera do modo infinito
+  float m_arrasteY{};
 
   int m_viewportWidth{};
   int m_viewportHeight{};
   GameData m_gameData;
 
-  // enum class GameState { Start, Play, Won, Lost };
-  static const int m_N{9};  // tamanho do tabuleiro
-  //define o número de bombas como 12% do tabuleiro, arredondado pra cima
-  int bombas = ceil(m_N * m_N * 0.12f);
-  // GameState m_gameState{GameState::Start};
-  std::array<char, m_N * m_N> m_bombas{};  // representação do conteudo de uma célula, onde X = bomba e 0-9 = número de bombas vizinhas
-  std::array<bool, m_N * m_N> m_clicado{}; //true = revelado, false = oculto
+  int m_N{9};  // tamanho do tabuleiro (m_N x m_N), escolhido no menu Options
+  int m_dificuldade{0}; // índice do combo de dificuldade (0 = Facil, 1 = Medio, 2 = Dificil)
+  Board m_board; // motor do tabuleiro: bombas e células reveladas
+  Solver m_solver; // deduções sobre o tabuleiro visível (usado nas dicas)
+  Probability m_probability; // probabilidades exatas quando o solver trava
+  History m_historico; // desfazer/refazer da partida atual (só o que cada passo mudou)
 
-  ImFont* m_font{};
+  std::random_device m_randomDevice; // fonte das sementes de cada partida
+  std::uint64_t m_seed{}; // semente da partida atual (permite reproduzir o tabuleiro)
+  int m_zonaSegura{1}; // raio sem bombas em volta do primeiro clique
+  bool m_semChute{false}; // gera só tabuleiros que o solver termina sem chutar
+  bool m_gerando{false}; // geração sem chute em andamento no pool de tarefas
+  int m_geracao{}; // identifica a geração atual; restart() invalida as pendentes
 
-  std::default_random_engine m_randomEngine;
+  bool m_infinito{false}; // modo infinito: a vista m_N x m_N anda por um InfiniteBoard
+  InfiniteBoard m_infinite;
+  std::int64_t m_cameraX{}; // célula do mundo no canto superior esquerdo da vista
+  std::int64_t m_cameraY{};
+  std::vector<Cell> m_vista; // células da vista com moldura, (m_N + 2) x (m_N + 2), para a textura
+
+  // replay: as ações da partida atual são gravadas em m_replay (só no modo
+  // normal; restart() limpa o registro e zera o relógio); Game > Ver replay
+  // reproduz um registro salvo em tempo real
+  ReplayLog m_replay;
+  bool m_gravando{false}; // a partida atual está no registro (começou com um Restart)
+  std::chrono::steady_clock::time_point m_inicioReplay{std::chrono::steady_clock::now()};
+  // compartilhado com a geração sem chute de um Restart do replay, que roda
+  // no pool (enquanto isso m_gerando fica ligado)
+  std::shared_ptr<ReplayPlayer> m_reproducao;
+  std::chrono::steady_clock::time_point m_inicioReproducao;
+
+  // torneio: bots jogam cópias do tabuleiro do jogador, cada um no pool de
+  // tarefas, e cada tabuleiro é desenhado na sua região da janela
+  struct Corredor {
+    std::shared_ptr<Bot> bot; // compartilhado com a jogada em andamento no pool
+    BoardTexture textura;
+    bool ocupado{}; // jogada em andamento: o bot não pode ser lido nem alterado
+    bool sujo{}; // a textura precisa ser enviada inteira (bot recém-iniciado)
+    DirtyRegions regioes; // células alteradas pelas jogadas desde o último envio
+    double intervalo{}; // segundos entre duas jogadas
+    std::chrono::steady_clock::time_point proxima; // instante da próxima jogada
+    int progresso{}; // células seguras reveladas, copiado no fim de cada jogada
+    GameState estado{GameState::Start};
+  };
+  bool m_torneio{false};
+  int m_numBots{3};
+  std::vector<Corredor> m_corredores;
+  int m_geracaoTorneio{}; // restart() descarta as jogadas em andamento
+  int m_vencedor{-1}; // primeiro a limpar o tabuleiro: 0 é o jogador, i o bot i
+  std::chrono::steady_clock::time_point m_inicioTorneio;
 
   void checkBoard(); //função que checa constantemente se o jogo terminou
   void restart(); //função que reinicia o jogo
   void preencher_tabuleiro(int); //função que cria as bombas em posições aleatórias exceto a clicada
-  void somar_vizinhos(int); //função que recebe uma célula e faz a soma de seus vizinhos
-  bool isVizinho(int, int); //função que responde se um n possui um vizinho válido v
-  void clicar_nos_vizinhos(int); //função que clica em todos os vizinhos de uma celula com valor zero
+  void clicar(int); //função que revela uma célula, atualiza o solver e checa o fim de jogo
+  void jogar(int offset, Acao acao); //aplica a ação do mouse sobre uma célula do tabuleiro do jogador
+  void bandeira(int offset); //põe ou tira a bandeira de uma célula oculta
+  void acorde(int offset); //revela as vizinhas de um número com todas as bandeiras postas
+  void jogar_infinito(int i, int j, Acao acao); //ação sobre a célula (i, j) da vista no modo infinito
+  void montar_vista(); //copia para m_vista as células do mundo que a vista mostra
+  void carregar_chunks(); //despacha a geração dos chunks pedidos e checa o fim de jogo infinito
+  void salvar(); //grava a partida atual em arquivoSalvo
+  void carregar(); //troca a partida atual pela de arquivoSalvo, se for válida
+  [[nodiscard]] std::uint64_t tempoReplay() const; //microssegundos desde o início do registro
+  void reproduzir(); //avança a reprodução até o quadro atual e mostra o tabuleiro dela
+  void mostrar_reproducao(); //troca o tabuleiro do jogador pelo da reprodução
+  void desfazer(); //desfaz a última revelação (inclusive a da bomba) ou bandeira
+  void refazer();
+  void reiniciar_torneio(); //descarta os bots e cria m_numBots novos, ainda sem tabuleiro
+  void iniciar_torneio(int clicada); //entrega aos bots cópias do tabuleiro recém-gerado
+  void tabuleiros(float altura); //regiões dos tabuleiros, cliques do jogador e placar do torneio
+  void enquadrar(); //mantém m_visao dentro do tabuleiro e com um zoom permitido
+  void mover_visao(float dx, float dy); //arrasta a vista em células (no modo infinito, a câmera)
+  void ampliar(float passos, int x, int y); //zoom da roda do mouse em volta do ponto (x, y) da janela
+  // (linha, coluna) da vista sob o ponto (x, y) da janela, se ele está no
+  // tabuleiro do jogador
+  [[nodiscard]] std::optional<std::pair<int, int>> celula_na_posicao(int x, int y) const;
+  void avancar_torneio(); //atualiza as texturas e despacha as jogadas dos bots cuja vez chegou
 };
 
 #endif
@@ -0,0 +1,321 @@
+#include "probability.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace {
+// coeficiente k = número (relativo) de configurações com k bombas
+using Polinomio = std::vector<double>;
+
+// restrição de um número revelado, em posições da ordem do componente
+struct Restricao {
+  std::vector<int> posicoes; // crescentes
+  int bombas{};
+};
+
+// resultado da enumeração de um componente
+struct Contagem {
+  Polinomio total; // total[k]: configurações com k bombas
+  std::vector<Polinomio> porCelula; // porCelula[t][k]: idem, com a célula t bomba
+};
+
+void somarDeslocado(Polinomio &destino, const Polinomio &origem, std::size_t deslocamento) {
+  if(destino.size() < origem.size() + deslocamento)
+    destino.resize(origem.size() + deslocamento, 0.0);
+  for(std::size_t k = 0; k < origem.size(); ++k)
+    destino[k + deslocamento] += origem[k];
+}
+
+Polinomio convolucao(const Polinomio &a, const Polinomio &b) {
+  if(a.empty() || b.empty()) return {};
+  Polinomio c(a.size() + b.size() - 1, 0.0);
+  for(std::size_t i = 0; i < a.size(); ++i)
+    for(std::size_t j = 0; j < b.size(); ++j)
+      c[i + j] += a[i] * b[j];
+  return c;
+}
+
+double logBinomial(int n, int k) {
+  return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+}
+
+// Enumera as configurações de um componente com n células. A célula t é
+// decidida no passo t; o estado entre dois passos é o número de bombas que
+// ainda falta a cada restrição aberta (com células dos dois lados), e
+// estados iguais são memorizados num único polinômio. Uma passada para frente
+// conta as formas de chegar a cada estado e uma para trás as formas de
+// completá-lo; o produto das duas dá a contagem por célula.
+Contagem enumerar(int n, const std::vector<Restricao> &restricoes) {
+  const auto total{static_cast<std::size_t>(n)};
+  std::vector<std::vector<int>> dePosicao(total);
+  std::vector<std::vector<int>> abertas(total + 1); // abertas[t]: primeira < t <= última
+  for(std::size_t q = 0; q < restricoes.size(); ++q)
+  {
+    const auto &r{restricoes[q]};
+    for(const auto p : r.posicoes) dePosicao[p].push_back(static_cast<int>(q));
+    for(int t = r.posicoes.front() + 1; t <= r.posicoes.back(); ++t)
+      abertas[t].push_back(static_cast<int>(q));
+  }
+
+  using Estado = std::vector<signed char>;
+  auto posicaoEm = [](const std::vector<int> &lista, int q) {
+    return std::lower_bound(lista.begin(), lista.end(), q) - lista.begin();
+  };
+  // decide a célula t com valor v a partir do estado s; false se violar
+  // alguma restrição
+  auto transicao = [&](int t, const Estado &s, int v, Estado &novo) {
+    const auto &antes{abertas[t]};
+    const auto &depois{abertas[t + 1]};
+    auto falta = [&](int q) {
+      const auto &r{restricoes[q]};
+      const int inicial = r.posicoes.front() == t ? r.bombas : s[posicaoEm(antes, q)];
+      return inicial - v;
+    };
+    for(const auto q : dePosicao[t])
+    {
+      const auto &r{restricoes[q]};
+      const auto restantes{r.posicoes.end() -
+                           std::upper_bound(r.posicoes.begin(), r.posicoes.end(), t)};
+      const int f = falta(q);
+      if(f < 0 || f > restantes) return false;
+    }
+    novo.resize(depois.size());
+    for(std::size_t k = 0; k < depois.size(); ++k)
+    {
+      const int q = depois[k];
+      const auto &r{restricoes[q]};
+      const bool contem = std::binary_search(r.posicoes.begin(), r.posicoes.end(), t);
+      novo[k] = static_cast<signed char>(contem ? falta(q) : s[posicaoEm(antes, q)]);
+    }
+    return true;
+  };
+
+  std::vector<std::map<Estado, Polinomio>> frente(total + 1);
+  frente[0][Estado{}] = Polinomio{1.0};
+  Estado novo;
+  for(int t = 0; t < n; ++t)
+    for(const auto &[s, formas] : frente[t])
+      for(const int v : {0, 1})
+        if(transicao(t, s, v, novo)) somarDeslocado(frente[t + 1][novo], formas, v);
+
+  std::vector<std::map<Estado, Polinomio>> tras(total + 1);
+  tras[total][Estado{}] = Polinomio{1.0};
+  for(int t = n - 1; t >= 0; --t)
+  {
+    for(const auto &[s, formas] : frente[t])
+    {
+      Polinomio completar;
+      for(const int v : {0, 1})
+      {
+        if(!transicao(t, s, v, novo)) continue;
+        if(const auto it{tras[t + 1].find(novo)}; it != tras[t + 1].end())
+          somarDeslocado(completar, it->second, v);
+      }
+      tras[t].emplace(s, std::move(completar));
+    }
+  }
+
+  Contagem contagem;
+  contagem.total = tras[0][Estado{}];
+  contagem.porCelula.resize(total);
+  for(int t = 0; t < n; ++t)
+  {
+    for(const auto &[s, formas] : frente[t])
+    {
+      if(!transicao(t, s, 1, novo)) continue;
+      if(const auto it{tras[t + 1].find(novo)}; it != tras[t + 1].end())
+        somarDeslocado(contagem.porCelula[t], convolucao(formas, it->second), 1);
+    }
+  }
+
+  // normaliza para evitar estouro ao combinar muitos componentes; as
+  // probabilidades não mudam com a escala de cada componente
+  const auto maior{contagem.total.empty()
+                       ? 0.0
+                       : *std::max_element(contagem.total.begin(), contagem.total.end())};
+  if(maior > 0.0)
+  {
+    for(auto &x : contagem.total) x /= maior;
+    for(auto &p : contagem.porCelula)
+      for(auto &x : p) x /= maior;
+  }
+  return contagem;
+}
+}  // namespace
+
+const std::vector<double> &Probability::compute(const Board &board, const Solver &solver) {
+  const int largura = board.width();
+  const int altura = board.height();
+  m_probabilidades.assign(static_cast<std::size_t>(board.size()), 0.0);
+  m_indice.assign(static_cast<std::size_t>(board.size()), -1);
+  m_fronteira.clear();
+
+  auto paraCadaVizinho = [&](int offset, auto &&f) {
+    const int i = offset / largura;
+    const int j = offset % largura;
+    for(int vi = std::max(i - 1, 0); vi <= std::min(i + 1, altura - 1); ++vi)
+      for(int vj = std::max(j - 1, 0); vj <= std::min(j + 1, largura - 1); ++vj)
+        if(vi != i || vj != j) f(vi * largura + vj, board.cellAt(vi, vj));
+  };
+
+  // classificar as ocultas: bombas conhecidas, fronteira e internas
+  int bombasConhecidas = 0;
+  int internas = 0;
+  for(int o = 0; o < board.size(); ++o)
+  {
+    if(board.isRevealed(o)) continue;
+    if(solver.knowledge(o) == Knowledge::Mine)
+    {
+      m_probabilidades[o] = 1.0;
+      ++bombasConhecidas;
+      continue;
+    }
+    if(solver.knowledge(o) == Knowledge::Safe) continue;
+    bool temNumero = false;
+    paraCadaVizinho(o, [&](int, Cell c) { temNumero = temNumero || cell::isRevealed(c); });
+    if(temNumero)
+    {
+      m_indice[o] = static_cast<int>(m_fronteira.size());
+      m_fronteira.push_back(o);
+    }
+    else
+    {
+      ++internas;
+    }
+  }
+
+  // restrições dos números e componentes conexos da fronteira
+  const auto nFronteira{m_fronteira.size()};
+  std::vector<Restricao> restricoes; // posicoes ainda em índices da fronteira
+  std::vector<std::vector<int>> restricoesDaCelula(nFronteira);
+  for(int o = 0; o < board.size(); ++o)
+  {
+    const Cell c = board.cellAt(o);
+    if(!cell::isRevealed(c) || cell::isMine(c)) continue;
+    Restricao r;
+    r.bombas = cell::count(c);
+    paraCadaVizinho(o, [&](int v, Cell vizinha) {
+      if(cell::isRevealed(vizinha)) return;
+      if(solver.knowledge(v) == Knowledge::Mine) --r.bombas;
+      else if(m_indice[v] >= 0) r.posicoes.push_back(m_indice[v]);
+    });
+    if(r.posicoes.empty()) continue;
+    for(const auto p : r.posicoes) restricoesDaCelula[p].push_back(static_cast<int>(restricoes.size()));
+    restricoes.push_back(std::move(r));
+  }
+
+  // cada componente sai de uma busca em largura pelas restrições, e suas
+  // células são enumeradas nessa ordem para manter poucas restrições
+  // abertas ao mesmo tempo
+  std::vector<int> posicao(nFronteira, -1);
+  std::vector<std::vector<int>> componentes;
+  std::vector<Contagem> contagens;
+  for(std::size_t inicio = 0; inicio < nFronteira; ++inicio)
+  {
+    if(posicao[inicio] >= 0) continue;
+    std::vector<int> ordem{static_cast<int>(inicio)};
+    posicao[inicio] = 0;
+    std::vector<int> ids; // restrições do componente
+    for(std::size_t k = 0; k < ordem.size(); ++k)
+    {
+      for(const auto q : restricoesDaCelula[ordem[k]])
+      {
+        for(const auto p : restricoes[q].posicoes)
+        {
+          if(posicao[p] >= 0) continue;
+          posicao[p] = static_cast<int>(ordem.size());
+          ordem.push_back(p);
+        }
+        ids.push_back(q);
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    std::vector<Restricao> locais;
+    locais.reserve(ids.size());
+    for(const auto q : ids)
+    {
+      Restricao r{{}, restricoes[q].bombas};
+      for(const auto p : restricoes[q].posicoes) r.posicoes.push_back(posicao[p]);
+      std::sort(r.posicoes.begin(), r.posicoes.end());
+      locais.push_back(std::move(r));
+    }
+    contagens.push_back(enumerar(static_cast<int>(ordem.size()), locais));
+    componentes.push_back(std::move(ordem));
+  }
+
+  // combinar: as bombas que sobram para as internas têm peso C(internas, resto)
+  const int restantes = board.mines() - bombasConhecidas;
+  const auto nComponentes{componentes.size()};
+  std::vector<Polinomio> prefixo(nComponentes + 1, Polinomio{1.0});
+  std::vector<Polinomio> sufixo(nComponentes + 1, Polinomio{1.0});
+  for(std::size_t c = 0; c < nComponentes; ++c)
+    prefixo[c + 1] = convolucao(prefixo[c], contagens[c].total);
+  for(std::size_t c = nComponentes; c-- > 0;)
+    sufixo[c] = convolucao(contagens[c].total, sufixo[c + 1]);
+  const auto &todos{prefixo[nComponentes]};
+
+  // peso das internas para K bombas na fronteira, relativo ao maior peso
+  std::vector<double> peso(todos.size(), 0.0);
+  double maiorLog = -HUGE_VAL;
+  for(std::size_t k = 0; k < peso.size(); ++k)
+  {
+    const int resto = restantes - static_cast<int>(k);
+    if(resto >= 0 && resto <= internas) maiorLog = std::max(maiorLog, logBinomial(internas, resto));
+  }
+  for(std::size_t k = 0; k < peso.size(); ++k)
+  {
+    const int resto = restantes - static_cast<int>(k);
+    if(resto >= 0 && resto <= internas) peso[k] = std::exp(logBinomial(internas, resto) - maiorLog);
+  }
+
+  double normalizacao = 0.0;
+  double bombasInternas = 0.0;
+  for(std::size_t k = 0; k < todos.size(); ++k)
+  {
+    normalizacao += todos[k] * peso[k];
+    bombasInternas += todos[k] * peso[k] * (restantes - static_cast<double>(k));
+  }
+  if(normalizacao <= 0.0) return m_probabilidades; //tabuleiro visível inconsistente
+
+  for(std::size_t c = 0; c < nComponentes; ++c)
+  {
+    // g[k] = peso combinado dos outros componentes e das internas quando este
+    // componente tem k bombas
+    const auto outros{convolucao(prefixo[c], sufixo[c + 1])};
+    Polinomio g(componentes[c].size() + 1, 0.0);
+    for(std::size_t k = 0; k < g.size(); ++k)
+      for(std::size_t j = 0; j < outros.size() && k + j < peso.size(); ++j)
+        g[k] += outros[j] * peso[k + j];
+
+    for(std::size_t t = 0; t < componentes[c].size(); ++t)
+    {
+      double p = 0.0;
+      const auto &porCelula{contagens[c].porCelula[t]};
+      for(std::size_t k = 0; k < porCelula.size() && k < g.size(); ++k)
+        p += porCelula[k] * g[k];
+      m_probabilidades[m_fronteira[componentes[c][t]]] = p / normalizacao;
+    }
+  }
+
+  if(internas > 0)
+  {
+    const double pInterna = bombasInternas / normalizacao / internas;
+    for(int o = 0; o < board.size(); ++o)
+      if(!board.isRevealed(o) && solver.knowledge(o) == Knowledge::Unknown && m_indice[o] < 0)
+        m_probabilidades[o] = pInterna;
+  }
+  return m_probabilidades;
+}
+
+int Probability::bestGuess(const Board &board) const {
+  int melhor = -1;
+  for(int o = 0; o < static_cast<int>(m_probabilidades.size()); ++o)
+  {
+    if(board.isRevealed(o) || m_probabilidades[o] >= 1.0) continue;
+    if(melhor < 0 || m_probabilidades[o] < m_probabilidades[melhor]) melhor = o;
+  }
+  return melhor;
+}
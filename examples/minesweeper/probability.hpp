@@ -0,0 +1,34 @@
+#ifndef PROBABILITY_HPP_
+#define PROBABILITY_HPP_
+
+#include <vector>
+
+#include "board.hpp"
+#include "solver.hpp"
+
+// Probabilidade exata de bomba de cada célula oculta, para quando as regras
+// determinísticas do Solver se esgotam.
+//
+// A fronteira (ocultas desconhecidas vizinhas de números) é dividida em
+// componentes independentes (células ligadas por restrições em comum, por
+// busca em largura); cada componente é enumerado por programação
+// dinâmica célula a célula, memorizando o estado das restrições ainda
+// abertas, o que dá o número de configurações com k bombas. As componentes
+// são combinadas com o peso binomial das células internas (ocultas sem
+// nenhum número vizinho), que dividem as bombas restantes.
+class Probability {
+ public:
+  // calcula e devolve a probabilidade de bomba de cada célula (0 para as
+  // reveladas e para as que o solver sabe serem seguras, 1 para as bombas
+  // conhecidas). Válido até a próxima chamada.
+  const std::vector<double>& compute(const Board& board, const Solver& solver);
+  // célula oculta com a menor probabilidade de bomba, ou -1 se não houver
+  [[nodiscard]] int bestGuess(const Board& board) const;
+
+ private:
+  std::vector<double> m_probabilidades;
+  std::vector<int> m_indice; // offset -> índice na fronteira (-1 se não for fronteira)
+  std::vector<int> m_fronteira; // offsets das células da fronteira
+};
+
+#endif
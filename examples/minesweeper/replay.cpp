@@ -0,0 +1,227 @@
+#include "replay.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "generator.hpp"
+
+namespace {
+constexpr std::array<char, 8> assinatura{'M', 'S', 'R', 'E', 'P', 'L', 'A', 'Y'};
+
+void escreverVarint(std::vector<std::uint8_t> &saida, std::uint64_t valor) {
+  while(valor >= 0x80)
+  {
+    saida.push_back(static_cast<std::uint8_t>(valor | 0x80));
+    valor >>= 7;
+  }
+  saida.push_back(static_cast<std::uint8_t>(valor));
+}
+
+// leitor sequencial; qualquer leitura além do fim invalida o registro
+class Leitor {
+ public:
+  Leitor(const std::uint8_t *dados, std::size_t tamanho) : m_p{dados}, m_fim{dados + tamanho} {}
+
+  std::uint64_t varint() {
+    std::uint64_t valor{};
+    for(int deslocamento = 0; deslocamento < 64; deslocamento += 7)
+    {
+      const auto byte{this->byte()};
+      valor |= static_cast<std::uint64_t>(byte & 0x7F) << deslocamento;
+      if((byte & 0x80) == 0) return valor;
+    }
+    throw std::runtime_error{"registro de replay corrompido"};
+  }
+  int inteiro() {
+    const auto valor{varint()};
+    if(valor > static_cast<std::uint64_t>(INT32_MAX)) throw std::runtime_error{"registro de replay corrompido"};
+    return static_cast<int>(valor);
+  }
+  std::uint8_t byte() {
+    if(m_p == m_fim) throw std::runtime_error{"registro de replay truncado"};
+    return *m_p++;
+  }
+
+ private:
+  const std::uint8_t *m_p;
+  const std::uint8_t *m_fim;
+};
+}  // namespace
+
+void ReplayLog::clear() {
+  m_eventos.clear();
+  m_partidas.clear();
+}
+
+void ReplayLog::restart(std::uint64_t time, const ReplayGame &game) {
+  m_partidas.push_back(game);
+  registrar(ReplayEvent::Type::Restart, time, static_cast<int>(m_partidas.size() - 1));
+}
+
+void ReplayLog::registrar(ReplayEvent::Type type, std::uint64_t time, int offset) {
+  m_eventos.push_back({type, std::max(time, duration()), offset});
+}
+
+std::vector<std::uint8_t> ReplayLog::encode() const {
+  std::vector<std::uint8_t> saida(assinatura.begin(), assinatura.end());
+  escreverVarint(saida, version);
+  escreverVarint(saida, m_eventos.size());
+  std::uint64_t anterior{};
+  for(const auto &evento : m_eventos)
+  {
+    saida.push_back(static_cast<std::uint8_t>(evento.type));
+    escreverVarint(saida, evento.time - anterior);
+    anterior = evento.time;
+    if(evento.type != ReplayEvent::Type::Restart)
+    {
+      escreverVarint(saida, static_cast<std::uint32_t>(evento.offset));
+      continue;
+    }
+    // os parâmetros da partida vão junto do evento que a inicia
+    const auto &partida{m_partidas[evento.offset]};
+    escreverVarint(saida, static_cast<std::uint32_t>(partida.width));
+    escreverVarint(saida, static_cast<std::uint32_t>(partida.height));
+    escreverVarint(saida, static_cast<std::uint32_t>(partida.mines));
+    escreverVarint(saida, partida.seed);
+    escreverVarint(saida, static_cast<std::uint32_t>(partida.safeRadius));
+    escreverVarint(saida, static_cast<std::uint32_t>(partida.start));
+    saida.push_back(partida.noGuess ? 1 : 0);
+  }
+  return saida;
+}
+
+ReplayLog ReplayLog::decode(const std::uint8_t *data, std::size_t size) {
+  if(size < assinatura.size() || std::memcmp(data, assinatura.data(), assinatura.size()) != 0)
+    throw std::runtime_error{"nao e um registro de replay"};
+  Leitor leitor{data + assinatura.size(), size - assinatura.size()};
+  const auto versao{leitor.varint()};
+  if(versao == 0 || versao > version) throw std::runtime_error{"versao de replay nao suportada"};
+
+  ReplayLog log;
+  const auto total{leitor.varint()};
+  std::uint64_t tempo{};
+  for(std::uint64_t n = 0; n < total; ++n)
+  {
+    const auto tipo{leitor.byte()};
+    if(tipo > static_cast<std::uint8_t>(ReplayEvent::Type::Redo))
+      throw std::runtime_error{"registro de replay corrompido"};
+    tempo += leitor.varint();
+    if(static_cast<ReplayEvent::Type>(tipo) != ReplayEvent::Type::Restart)
+    {
+      const auto offset{leitor.inteiro()};
+      log.registrar(static_cast<ReplayEvent::Type>(tipo), tempo, offset);
+      continue;
+    }
+    ReplayGame partida;
+    partida.width = leitor.inteiro();
+    partida.height = leitor.inteiro();
+    partida.mines = leitor.inteiro();
+    partida.seed = leitor.varint();
+    partida.safeRadius = leitor.inteiro();
+    partida.start = leitor.inteiro();
+    partida.noGuess = leitor.byte() != 0;
+    const auto celulas{static_cast<std::int64_t>(partida.width) * partida.height};
+    if(partida.width <= 0 || partida.height <= 0 || celulas > INT32_MAX / 2 || partida.start >= celulas)
+      throw std::runtime_error{"registro de replay corrompido"};
+    log.restart(tempo, partida);
+  }
+  return log;
+}
+
+void ReplayLog::save(const std::string &path) const {
+  const auto dados{encode()};
+  std::ofstream arquivo{path, std::ios::binary | std::ios::trunc};
+  arquivo.write(reinterpret_cast<const char *>(dados.data()), static_cast<std::streamsize>(dados.size()));
+  arquivo.close();
+  if(!arquivo) throw std::runtime_error{path + ": erro ao gravar o replay"};
+}
+
+ReplayLog ReplayLog::load(const std::string &path) {
+  std::ifstream arquivo{path, std::ios::binary};
+  if(!arquivo) throw std::runtime_error{path + ": nao foi possivel abrir o replay"};
+  const std::vector<std::uint8_t> dados{std::istreambuf_iterator<char>{arquivo},
+                                        std::istreambuf_iterator<char>{}};
+  return decode(dados.data(), dados.size());
+}
+
+void ReplayPlayer::rewind() {
+  m_board = Board{};
+  m_historico.clear();
+  m_iniciada = false;
+  m_posicao = 0;
+  m_tempo = 0;
+}
+
+bool ReplayPlayer::step() {
+  if(finished()) return false;
+  const auto &evento{m_log.events()[m_posicao++]};
+  m_tempo = evento.time;
+  aplicar(evento);
+  return true;
+}
+
+std::size_t ReplayPlayer::advanceTo(std::uint64_t time) {
+  const auto inicio{m_posicao};
+  const auto &eventos{m_log.events()};
+  while(m_posicao < eventos.size() && eventos[m_posicao].time <= time) step();
+  return m_posicao - inicio;
+}
+
+const ReplayEvent *ReplayPlayer::next() const {
+  return finished() ? nullptr : &m_log.events()[m_posicao];
+}
+
+void ReplayPlayer::setExecutor(NoGuessExecutor executor, unsigned threads) {
+  m_executor = std::move(executor);
+  m_threads = threads;
+}
+
+void ReplayPlayer::seek(std::uint64_t time) {
+  // o estado só pode ser reconstruído para a frente: voltar no tempo
+  // recomeça do início
+  if(time < m_tempo) rewind();
+  advanceTo(time);
+}
+
+void ReplayPlayer::aplicar(const ReplayEvent &evento) {
+  if(evento.type == ReplayEvent::Type::Restart)
+  {
+    const auto &partida{m_log.games()[evento.offset]};
+    m_board.reset(partida.width, partida.height, partida.mines);
+    if(partida.noGuess)
+      fillNoGuess(m_board, partida.start, partida.seed, partida.safeRadius, 10000, m_threads, m_executor);
+    else
+      m_board.fill(partida.start, partida.seed, partida.safeRadius);
+    m_historico.clear();
+    m_iniciada = true;
+    return;
+  }
+
+  // desfazer também vale depois do fim da partida (desfaz o clique na bomba)
+  if(m_iniciada && evento.type == ReplayEvent::Type::Undo)
+  {
+    m_historico.undo(m_board);
+    return;
+  }
+  if(m_iniciada && evento.type == ReplayEvent::Type::Redo)
+  {
+    m_historico.redo(m_board);
+    return;
+  }
+
+  // como no jogo: sem partida, ou depois do fim dela, os cliques não contam
+  if(!m_iniciada || over() || evento.offset < 0 || evento.offset >= m_board.size()) return;
+  switch(evento.type)
+  {
+    case ReplayEvent::Type::Reveal: m_historico.recordReveal(m_board.reveal(evento.offset)); break;
+    case ReplayEvent::Type::Flag:
+      if(m_board.toggleFlag(evento.offset)) m_historico.recordFlag(evento.offset);
+      break;
+    case ReplayEvent::Type::Chord: m_historico.recordReveal(m_board.chord(evento.offset)); break;
+    default: break;
+  }
+}
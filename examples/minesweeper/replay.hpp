@@ -0,0 +1,114 @@
+#ifndef REPLAY_HPP_
+#define REPLAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "board.hpp"
+#include "generator.hpp"
+#include "history.hpp"
+
+// Parâmetros de uma partida: com eles o tabuleiro é recriado exatamente
+// (Board::fill e fillNoGuess são determinísticos dada a semente)
+struct ReplayGame {
+  int width{};
+  int height{};
+  int mines{};
+  std::uint64_t seed{};
+  int safeRadius{};
+  bool noGuess{};
+  int start{}; // célula em volta da qual a zona segura foi criada (o primeiro clique)
+};
+
+// Uma ação do jogador. Restart marca o início de uma partida, no momento em
+// que o tabuleiro é gerado; offset é então o índice da partida em
+// ReplayLog::games(). Undo e Redo não usam offset
+struct ReplayEvent {
+  enum class Type : std::uint8_t { Restart, Reveal, Flag, Chord, Undo, Redo };
+  Type type{};
+  std::uint64_t time{}; // microssegundos desde o início do registro
+  int offset{};
+};
+
+// Registro de ações por eventos: a semente de cada partida mais a sequência
+// de cliques reconstroem qualquer estado do jogo. Os tempos nunca decrescem.
+//
+// No arquivo cada evento ocupa poucos bytes: o tipo, o intervalo desde o
+// evento anterior e a célula, como varints (7 bits por byte). Arquivos de
+// versão maior que a suportada são recusados (a versão 2 acrescentou Undo e
+// Redo).
+class ReplayLog {
+ public:
+  static constexpr std::uint32_t version{2};
+
+  void clear();
+  void restart(std::uint64_t time, const ReplayGame& game);
+  void reveal(std::uint64_t time, int offset) { registrar(ReplayEvent::Type::Reveal, time, offset); }
+  void flag(std::uint64_t time, int offset) { registrar(ReplayEvent::Type::Flag, time, offset); }
+  void chord(std::uint64_t time, int offset) { registrar(ReplayEvent::Type::Chord, time, offset); }
+  void undo(std::uint64_t time) { registrar(ReplayEvent::Type::Undo, time, 0); }
+  void redo(std::uint64_t time) { registrar(ReplayEvent::Type::Redo, time, 0); }
+
+  [[nodiscard]] const std::vector<ReplayEvent>& events() const { return m_eventos; }
+  [[nodiscard]] const std::vector<ReplayGame>& games() const { return m_partidas; }
+  [[nodiscard]] bool empty() const { return m_eventos.empty(); }
+  [[nodiscard]] std::uint64_t duration() const { return m_eventos.empty() ? 0 : m_eventos.back().time; }
+
+  [[nodiscard]] std::vector<std::uint8_t> encode() const;
+  // lança std::runtime_error se os dados não forem um registro válido
+  [[nodiscard]] static ReplayLog decode(const std::uint8_t* data, std::size_t size);
+  void save(const std::string& path) const; //lança std::runtime_error se falhar
+  [[nodiscard]] static ReplayLog load(const std::string& path);
+
+ private:
+  std::vector<ReplayEvent> m_eventos;
+  std::vector<ReplayGame> m_partidas;
+
+  void registrar(ReplayEvent::Type type, std::uint64_t time, int offset);
+};
+
+// Reprodutor de um ReplayLog: aplica os eventos a um Board com as mesmas
+// regras do jogo (depois de uma bomba ou da vitória só desfazer e refazer
+// mudam o tabuleiro; bandeira e acorde só em partidas iniciadas). Pode andar
+// um evento por vez, até um
+// instante (reprodução em tempo real, quadro a quadro) ou até o fim o mais
+// rápido possível.
+class ReplayPlayer {
+ public:
+  explicit ReplayPlayer(ReplayLog log) : m_log{std::move(log)} {}
+
+  void rewind(); //volta para antes do primeiro evento
+  bool step(); //aplica o próximo evento; false se não houver mais
+  std::size_t advanceTo(std::uint64_t time); //aplica os eventos até time (inclusive); retorna quantos
+  void seek(std::uint64_t time); //como advanceTo, mas também volta no tempo
+  std::size_t runToEnd() { return advanceTo(UINT64_MAX); }
+
+  [[nodiscard]] const ReplayLog& log() const { return m_log; }
+  [[nodiscard]] const Board& board() const { return m_board; }
+  [[nodiscard]] bool started() const { return m_iniciada; } //há uma partida com tabuleiro gerado
+  [[nodiscard]] bool over() const { return m_iniciada && (m_board.exploded() || m_board.cleared()); }
+  [[nodiscard]] std::size_t position() const { return m_posicao; } //eventos já aplicados
+  [[nodiscard]] bool finished() const { return m_posicao == m_log.events().size(); }
+  [[nodiscard]] std::uint64_t time() const { return m_tempo; } //instante do último evento aplicado
+  [[nodiscard]] const ReplayEvent* next() const; //próximo evento a aplicar, ou nullptr no fim
+  // executor e threads das gerações sem chute (ver fillNoGuess); sem executor
+  // elas usam threads próprias
+  void setExecutor(NoGuessExecutor executor, unsigned threads);
+
+ private:
+  ReplayLog m_log;
+  Board m_board;
+  History m_historico; // desfazer/refazer da partida atual
+  bool m_iniciada{};
+  std::size_t m_posicao{};
+  std::uint64_t m_tempo{};
+  NoGuessExecutor m_executor;
+  unsigned m_threads{};
+
+  void aplicar(const ReplayEvent& evento);
+};
+
+#endif
@@ -0,0 +1,440 @@
+// Simulador do campo minado sem interface gráfica: joga N partidas com uma
+// estratégia e imprime a taxa de vitória e histogramas de chutes e de tempo
+// por partida. Serve para calibrar densidades e dificuldades.
+//
+// Uso: minesweeper_sim [--games=N] [--strategy=random|solver|greedy]
+//                      [--size=LxA] [--mines=N | --density=fração]
+//                      [--safe-radius=N] [--threads=N] [--seed=N]
+//                      [--record=arquivo]
+//        minesweeper_sim --replay=arquivo
+//
+// As partidas são divididas entre as threads em lotes; a partida g usa um
+// fluxo de números aleatórios derivado de (seed, g), então o resultado não
+// depende do número de threads. O fluxo é um splitmix64 (splitmix.hpp), que
+// sorteia o tabuleiro e depois os chutes sem semear um gerador novo.
+//
+// --record grava todas as partidas num registro de replay (replay.hpp), em
+// uma única thread. Como o replay recria o tabuleiro com Board::fill(seed),
+// as partidas gravadas sorteiam as bombas por ele, e os tabuleiros diferem
+// dos de uma execução sem --record com a mesma semente. --replay reproduz um registro (do simulador ou do jogo)
+// o mais rápido possível e imprime o resultado e uma impressão digital do
+// tabuleiro final, para comparar o motor entre commits sem interface.
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "board.hpp"
+#include "probability.hpp"
+#include "replay.hpp"
+#include "solver.hpp"
+#include "splitmix.hpp"
+
+namespace {
+
+using Relogio = std::chrono::steady_clock;
+
+enum class Estrategia { Aleatoria, Solver, Gulosa };
+
+struct Opcoes {
+  long partidas{100000};
+  Estrategia estrategia{Estrategia::Solver};
+  int largura{9};
+  int altura{9};
+  int bombas{-1}; // -1: usar a densidade
+  double densidade{0.12}; // a mesma do jogo
+  int zonaSegura{1};
+  unsigned threads{0}; // 0: todos os núcleos
+  std::uint64_t semente{1};
+  std::string gravar; // --record
+  std::string reproduzir; // --replay
+};
+
+constexpr int maxChutes{16}; // última faixa do histograma: 16 ou mais chutes
+constexpr int faixasTempo{40}; // faixa k: tempo em [2^k, 2^(k+1)) ns
+
+// Acumuladores de uma thread; somados ao final
+struct Estatisticas {
+  long partidas{};
+  long vitorias{};
+  std::array<long, maxChutes + 1> partidasPorChutes{};
+  std::array<long, maxChutes + 1> vitoriasPorChutes{};
+  std::array<long, faixasTempo> tempos{};
+  double nsTotal{};
+
+  void somar(const Estatisticas &outra) {
+    partidas += outra.partidas;
+    vitorias += outra.vitorias;
+    nsTotal += outra.nsTotal;
+    for(std::size_t k = 0; k < partidasPorChutes.size(); ++k)
+    {
+      partidasPorChutes[k] += outra.partidasPorChutes[k];
+      vitoriasPorChutes[k] += outra.vitoriasPorChutes[k];
+    }
+    for(std::size_t k = 0; k < tempos.size(); ++k) tempos[k] += outra.tempos[k];
+  }
+};
+
+// semente da partida g: mistura splitmix64 de (semente, g)
+std::uint64_t sementeDaPartida(std::uint64_t semente, long g) {
+  std::uint64_t z = semente + static_cast<std::uint64_t>(g + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// Estado de jogo reaproveitado entre as partidas de uma thread: nada é
+// realocado depois da primeira partida
+class Jogador {
+ public:
+  explicit Jogador(const Opcoes &opcoes, ReplayLog *gravacao = nullptr)
+      : m_opcoes{opcoes}, m_board{opcoes.largura, opcoes.altura, opcoes.bombas}, m_gravacao{gravacao} {}
+
+  // joga uma partida; retorna o número de chutes (cliques não garantidos)
+  int jogar(long partida) {
+    const auto semente{sementeDaPartida(m_opcoes.semente, partida)};
+    m_gerador = SplitMix64{semente};
+    const int centro = (m_opcoes.altura / 2) * m_opcoes.largura + m_opcoes.largura / 2;
+
+    m_board.reset(m_opcoes.largura, m_opcoes.altura, m_opcoes.bombas);
+    if(m_gravacao == nullptr)
+    {
+      m_board.fill(centro, m_gerador, m_opcoes.zonaSegura);
+    }
+    else
+    {
+      m_board.fill(centro, semente, m_opcoes.zonaSegura); //o que o replay recria
+      m_gravacao->restart(agora(), {m_opcoes.largura, m_opcoes.altura, m_opcoes.bombas, semente,
+                                    m_opcoes.zonaSegura, false, centro});
+    }
+    revelar(centro);
+    if(m_opcoes.estrategia == Estrategia::Aleatoria) return jogarAleatorio();
+
+    int chutes = 0;
+    m_solver.reset(m_board);
+    while(!m_board.exploded() && !m_board.cleared())
+    {
+      int offset = m_solver.nextSafe(m_board);
+      if(offset < 0)
+      {
+        ++chutes;
+        if(m_opcoes.estrategia == Estrategia::Gulosa)
+        {
+          m_probabilidade.compute(m_board, m_solver);
+          offset = m_probabilidade.bestGuess(m_board);
+        }
+        else
+        {
+          offset = sortearOculta(true);
+        }
+      }
+      m_solver.update(m_board, revelar(offset));
+    }
+    return chutes;
+  }
+
+  [[nodiscard]] bool venceu() const { return m_board.cleared(); }
+
+ private:
+  const Opcoes &m_opcoes;
+  Board m_board;
+  Solver m_solver;
+  Probability m_probabilidade;
+  SplitMix64 m_gerador; // fluxo da partida: as bombas e depois os chutes
+  ReplayLog *m_gravacao{};
+  Relogio::time_point m_inicio{Relogio::now()};
+
+  [[nodiscard]] std::uint64_t agora() const {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(Relogio::now() - m_inicio).count());
+  }
+  const std::vector<int> &revelar(int offset) {
+    if(m_gravacao != nullptr) m_gravacao->reveal(agora(), offset);
+    return m_board.reveal(offset);
+  }
+
+  int jogarAleatorio() {
+    int chutes = 0;
+    while(!m_board.exploded() && !m_board.cleared())
+    {
+      ++chutes;
+      revelar(sortearOculta(false));
+    }
+    return chutes;
+  }
+
+  // célula oculta uniforme (excluindo as bombas que o solver conhece, se
+  // pedido); por rejeição, com uma varredura se o tabuleiro estiver quase
+  // todo revelado
+  int sortearOculta(bool evitarBombasConhecidas) {
+    auto serve = [&](int o) {
+      return !m_board.isRevealed(o) &&
+             !(evitarBombasConhecidas && m_solver.knowledge(o) == Knowledge::Mine);
+    };
+    std::uniform_int_distribution<int> sorteio(0, m_board.size() - 1);
+    for(int tentativa = 0; tentativa < 64; ++tentativa)
+      if(const int o = sorteio(m_gerador); serve(o)) return o;
+
+    std::vector<int> ocultas;
+    for(int o = 0; o < m_board.size(); ++o)
+      if(serve(o)) ocultas.push_back(o);
+    return ocultas[std::uniform_int_distribution<std::size_t>(0, ocultas.size() - 1)(m_gerador)];
+  }
+};
+
+Estatisticas simular(const Opcoes &opcoes, ReplayLog *gravacao) {
+  constexpr long lote{256}; // partidas por reserva do contador compartilhado
+  std::atomic<long> proxima{0};
+  // a gravação guarda as partidas em ordem, então usa uma única thread
+  const auto threads{gravacao != nullptr ? 1U
+                     : opcoes.threads > 0 ? opcoes.threads
+                                          : std::max(std::thread::hardware_concurrency(), 1U)};
+  std::vector<Estatisticas> porThread(threads);
+
+  auto trabalhar = [&](unsigned t) {
+    Jogador jogador{opcoes, gravacao};
+    auto &estatisticas{porThread[t]};
+    for(long inicio = proxima.fetch_add(lote); inicio < opcoes.partidas;
+        inicio = proxima.fetch_add(lote))
+    {
+      const auto fim{std::min(inicio + lote, opcoes.partidas)};
+      for(long g = inicio; g < fim; ++g)
+      {
+        const auto antes{Relogio::now()};
+        const int chutes = std::min(jogador.jogar(g), maxChutes);
+        const auto ns{std::chrono::duration<double, std::nano>(Relogio::now() - antes).count()};
+
+        const bool venceu = jogador.venceu();
+        ++estatisticas.partidas;
+        estatisticas.vitorias += venceu;
+        ++estatisticas.partidasPorChutes[chutes];
+        estatisticas.vitoriasPorChutes[chutes] += venceu;
+        const auto faixa{std::bit_width(static_cast<std::uint64_t>(std::max(ns, 1.0))) - 1};
+        ++estatisticas.tempos[std::min<std::size_t>(faixa, faixasTempo - 1)];
+        estatisticas.nsTotal += ns;
+      }
+    }
+  };
+
+  std::vector<std::thread> auxiliares;
+  for(unsigned t = 1; t < threads; ++t) auxiliares.emplace_back(trabalhar, t);
+  trabalhar(0);
+  for(auto &auxiliar : auxiliares) auxiliar.join();
+
+  Estatisticas total;
+  for(const auto &e : porThread) total.somar(e);
+  return total;
+}
+
+std::string barra(long valor, long maximo) {
+  constexpr int largura{40};
+  const auto n{maximo > 0 ? static_cast<int>(std::lround(largura * static_cast<double>(valor) / static_cast<double>(maximo))) : 0};
+  return std::string(static_cast<std::size_t>(std::clamp(n, valor > 0 ? 1 : 0, largura)), '#');
+}
+
+std::string formatarNs(double ns) {
+  if(ns < 1e3) return fmt::format("{:.0f} ns", ns);
+  if(ns < 1e6) return fmt::format("{:.1f} us", ns / 1e3);
+  if(ns < 1e9) return fmt::format("{:.1f} ms", ns / 1e6);
+  return fmt::format("{:.2f} s", ns / 1e9);
+}
+
+void imprimir(const Opcoes &opcoes, const Estatisticas &e, double segundos) {
+  constexpr std::array nomes{"random", "solver", "greedy"};
+  const auto taxa{static_cast<double>(e.vitorias) / static_cast<double>(e.partidas)};
+  // intervalo de confiança de 95% pela aproximação normal
+  const auto margem{1.96 * std::sqrt(taxa * (1.0 - taxa) / static_cast<double>(e.partidas))};
+
+  fmt::print("{}x{}, {} bombas, estrategia {}, {} partidas\n", opcoes.largura, opcoes.altura,
+             opcoes.bombas, nomes[static_cast<int>(opcoes.estrategia)], e.partidas);
+  fmt::print("vitorias: {} ({:.2f}% +- {:.2f}%)\n", e.vitorias, taxa * 100.0, margem * 100.0);
+  fmt::print("{:.0f} partidas/s, {} por partida (tempo de parede {:.2f} s)\n\n",
+             static_cast<double>(e.partidas) / segundos,
+             formatarNs(e.nsTotal / static_cast<double>(e.partidas)), segundos);
+
+  fmt::print("chutes    partidas  vitorias\n");
+  const auto maiorChutes{
+      *std::max_element(e.partidasPorChutes.begin(), e.partidasPorChutes.end())};
+  for(int k = 0; k <= maxChutes; ++k)
+  {
+    const auto n{e.partidasPorChutes[k]};
+    if(n == 0) continue;
+    fmt::print("{:>3}{} {:>11} {:>8.2f}% {}\n", k, k == maxChutes ? "+" : " ", n,
+               100.0 * static_cast<double>(e.vitoriasPorChutes[k]) / static_cast<double>(n),
+               barra(n, maiorChutes));
+  }
+
+  fmt::print("\ntempo por partida\n");
+  const auto maiorTempo{*std::max_element(e.tempos.begin(), e.tempos.end())};
+  for(int k = 0; k < faixasTempo; ++k)
+  {
+    if(e.tempos[k] == 0) continue;
+    fmt::print("{:>9} - {:<9} {:>11} {}\n", formatarNs(std::ldexp(1.0, k)),
+               formatarNs(std::ldexp(1.0, k + 1)), e.tempos[k], barra(e.tempos[k], maiorTempo));
+  }
+}
+
+// reproduz o registro inteiro e imprime o resultado das partidas
+int reproduzir(const std::string &caminho) {
+  const auto carregamento{Relogio::now()};
+  ReplayPlayer reprodutor{ReplayLog::load(caminho)};
+  const auto segundosCarga{std::chrono::duration<double>(Relogio::now() - carregamento).count()};
+
+  long vitorias = 0;
+  long derrotas = 0;
+  auto contar = [&] {
+    if(!reprodutor.started()) return;
+    vitorias += reprodutor.board().cleared();
+    derrotas += reprodutor.board().exploded();
+  };
+  const auto &eventos{reprodutor.log().events()};
+  const auto inicio{Relogio::now()};
+  while(!reprodutor.finished())
+  {
+    if(eventos[reprodutor.position()].type == ReplayEvent::Type::Restart) contar(); //fim da partida anterior
+    reprodutor.step();
+  }
+  contar();
+  const auto segundos{std::chrono::duration<double>(Relogio::now() - inicio).count()};
+
+  // impressão digital (FNV-1a) do tabuleiro final, com a moldura
+  const auto &board{reprodutor.board()};
+  std::uint64_t impressao{0xCBF29CE484222325ULL};
+  for(int i = -1; i <= board.height(); ++i)
+    for(int j = -1; j <= board.width(); ++j)
+      impressao = (impressao ^ board.row(i)[j]) * 0x100000001B3ULL;
+
+  const auto partidas{reprodutor.log().games().size()};
+  fmt::print("{}: {} eventos, {} partidas, duracao gravada {:.3f} s (carregado em {})\n", caminho,
+             eventos.size(), partidas, static_cast<double>(reprodutor.log().duration()) / 1e6,
+             formatarNs(segundosCarga * 1e9));
+  fmt::print("vitorias {}, derrotas {}, sem fim {}\n", vitorias, derrotas,
+             static_cast<long>(partidas) - vitorias - derrotas);
+  fmt::print("{:.0f} eventos/s (tempo de parede {:.3f} s)\n",
+             static_cast<double>(eventos.size()) / std::max(segundos, 1e-9), segundos);
+  fmt::print("tabuleiro final {}x{}, impressao digital {:016x}\n", board.width(), board.height(),
+             impressao);
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Opcoes opcoes;
+  const std::vector<std::string_view> argumentos(argv + 1, argv + argc);
+  bool valido = true;
+  for(const auto argumento : argumentos)
+  {
+    try
+    {
+      auto valor = [&](std::string_view prefixo) {
+        return std::string{argumento.substr(prefixo.size())};
+      };
+      if(argumento.starts_with("--games="))
+        opcoes.partidas = std::stol(valor("--games="));
+      else if(argumento == "--strategy=random")
+        opcoes.estrategia = Estrategia::Aleatoria;
+      else if(argumento == "--strategy=solver")
+        opcoes.estrategia = Estrategia::Solver;
+      else if(argumento == "--strategy=greedy")
+        opcoes.estrategia = Estrategia::Gulosa;
+      else if(argumento.starts_with("--size="))
+      {
+        const auto tamanho{valor("--size=")};
+        const auto x{tamanho.find('x')};
+        opcoes.largura = std::stoi(tamanho.substr(0, x));
+        opcoes.altura = x == std::string::npos ? opcoes.largura : std::stoi(tamanho.substr(x + 1));
+      }
+      else if(argumento.starts_with("--mines="))
+        opcoes.bombas = std::stoi(valor("--mines="));
+      else if(argumento.starts_with("--density="))
+        opcoes.densidade = std::stod(valor("--density="));
+      else if(argumento.starts_with("--safe-radius="))
+        opcoes.zonaSegura = std::stoi(valor("--safe-radius="));
+      else if(argumento.starts_with("--threads="))
+        opcoes.threads = static_cast<unsigned>(std::stoul(valor("--threads=")));
+      else if(argumento.starts_with("--seed="))
+        opcoes.semente = std::stoull(valor("--seed="));
+      else if(argumento.starts_with("--record="))
+        opcoes.gravar = valor("--record=");
+      else if(argumento.starts_with("--replay="))
+        opcoes.reproduzir = valor("--replay=");
+      else
+        valido = false;
+    }
+    catch(const std::logic_error &)
+    {
+      valido = false; //número inválido ou fora do intervalo (stoi e afins)
+    }
+  }
+  if(!valido || opcoes.partidas <= 0 || opcoes.largura <= 0 || opcoes.altura <= 0)
+  {
+    fmt::print(stderr,
+               "Uso: {} [--games=N] [--strategy=random|solver|greedy] [--size=LxA]\n"
+               "       [--mines=N | --density=fracao] [--safe-radius=N] [--threads=N]\n"
+               "       [--seed=N] [--record=arquivo]\n"
+               "       {} --replay=arquivo\n",
+               argv[0], argv[0]);
+    return 1;
+  }
+  if(!opcoes.reproduzir.empty())
+  {
+    try
+    {
+      return reproduzir(opcoes.reproduzir);
+    }
+    catch(const std::runtime_error &erro)
+    {
+      fmt::print(stderr, "{}\n", erro.what());
+      return 1;
+    }
+  }
+  if(opcoes.bombas < 0)
+    opcoes.bombas = static_cast<int>(std::ceil(opcoes.largura * opcoes.altura * opcoes.densidade));
+  // Board::fill reduziria o número de bombas em silêncio, e o relatório
+  // mostraria um tabuleiro que não foi jogado: as bombas têm que caber fora
+  // da zona segura em volta do clique central
+  {
+    auto lado = [r = opcoes.zonaSegura](int n) {
+      return std::min(n - 1, n / 2 + r) - std::max(0, n / 2 - r) + 1; //largura da zona, cortada na borda
+    };
+    const int livres = opcoes.largura * opcoes.altura - lado(opcoes.largura) * lado(opcoes.altura);
+    if(opcoes.bombas > livres)
+    {
+      fmt::print(stderr, "{} bombas nao cabem em {}x{}: no maximo {} fora da zona segura.\n", opcoes.bombas,
+                 opcoes.largura, opcoes.altura, livres);
+      return 1;
+    }
+  }
+
+  ReplayLog gravacao;
+  const auto inicio{Relogio::now()};
+  const auto estatisticas{simular(opcoes, opcoes.gravar.empty() ? nullptr : &gravacao)};
+  imprimir(opcoes, estatisticas, std::chrono::duration<double>(Relogio::now() - inicio).count());
+  if(!opcoes.gravar.empty())
+  {
+    try
+    {
+      gravacao.save(opcoes.gravar);
+    }
+    catch(const std::runtime_error &erro)
+    {
+      fmt::print(stderr, "{}\n", erro.what());
+      return 1;
+    }
+    fmt::print("\n{} eventos gravados em {}\n", gravacao.events().size(), opcoes.gravar);
+  }
+  return 0;
+}
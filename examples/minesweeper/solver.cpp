@@ -0,0 +1,202 @@
+#include "solver.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+// chama f(offset, célula) para cada vizinho de offset dentro do tabuleiro.
+// Os vizinhos são lidos pelas linhas com moldura do Board, sem testes de
+// limite; só as sentinelas são descartadas
+template <typename F>
+void paraCadaVizinho(const Board &board, int offset, F &&f) {
+  const int largura = board.width();
+  const int i = offset / largura;
+  const int j = offset % largura;
+  for(int vi = i - 1; vi <= i + 1; ++vi)
+  {
+    const Cell *linha = board.row(vi);
+    for(int vj = j - 1; vj <= j + 1; ++vj)
+    {
+      const Cell c = linha[vj];
+      if((vi != i || vj != j) && (c & cell::borderBit) == 0) f(vi * largura + vj, c);
+    }
+  }
+}
+
+// true se todos os elementos de a estão em b (ambos com no máximo 8 elementos)
+template <typename R>
+bool contido(const R &a, const R &b) {
+  for(int k = 0; k < a.tamanho; ++k)
+    if(std::find(b.ocultas.begin(), b.ocultas.begin() + b.tamanho, a.ocultas[k]) ==
+       b.ocultas.begin() + b.tamanho)
+      return false;
+  return true;
+}
+}  // namespace
+
+void Solver::reset(const Board &board) {
+  m_width = board.width();
+  m_height = board.height();
+  m_bombasConhecidas = 0;
+  m_restoMarcado = false;
+  m_conhecimento.assign(static_cast<std::size_t>(board.size()),
+                        static_cast<std::uint8_t>(Knowledge::Unknown));
+  m_naFila.assign(static_cast<std::size_t>(board.size()), 0);
+  m_fila.clear();
+  m_seguras.clear();
+
+  for(int i = 0; i < m_height; ++i)
+    for(int j = 0; j < m_width; ++j)
+      if(const Cell c = board.cellAt(i, j); cell::isRevealed(c) && !cell::isZero(c))
+        enfileirar(i * m_width + j);
+  propagar(board);
+}
+
+void Solver::update(const Board &board, const std::vector<int> &revealed) {
+  // cada célula revelada é um novo número e diminui as ocultas dos números
+  // vizinhos; nada mais no tabuleiro precisa ser reexaminado
+  for(const auto offset : revealed)
+  {
+    if(!cell::isZero(board.cellAt(offset))) enfileirar(offset);
+    enfileirar_vizinhos(board, offset);
+  }
+  propagar(board);
+}
+
+int Solver::nextSafe(const Board &board) {
+  for(int tentativa = 0; tentativa < 2; ++tentativa)
+  {
+    while(!m_seguras.empty())
+    {
+      const int offset = m_seguras.back();
+      if(!board.isRevealed(offset)) return offset;
+      m_seguras.pop_back();
+    }
+
+    // regra da contagem global: com todas as bombas encontradas, o resto das
+    // ocultas é seguro. Só roda quando as regras locais se esgotam
+    if(m_restoMarcado || m_bombasConhecidas != board.mines()) break;
+    m_restoMarcado = true;
+    for(int i = 0; i < board.size(); ++i)
+      if(knowledge(i) == Knowledge::Unknown && !board.isRevealed(i))
+        marcar(board, i, Knowledge::Safe);
+    m_fila.clear(); //as vizinhas enfileiradas não têm mais o que deduzir
+    std::fill(m_naFila.begin(), m_naFila.end(), 0);
+  }
+  return -1;
+}
+
+void Solver::enfileirar(int offset) {
+  if(m_naFila[offset] != 0) return;
+  m_naFila[offset] = 1;
+  m_fila.push_back(offset);
+}
+
+void Solver::enfileirar_vizinhos(const Board &board, int offset) {
+  // zeros revelados não restringem nada: todas as suas vizinhas já foram
+  // reveladas pelo preenchimento
+  paraCadaVizinho(board, offset, [&](int v, Cell c) {
+    if(cell::isRevealed(c) && !cell::isZero(c)) enfileirar(v);
+  });
+}
+
+void Solver::propagar(const Board &board) {
+  while(!m_fila.empty())
+  {
+    const int offset = m_fila.back();
+    m_fila.pop_back();
+    m_naFila[offset] = 0;
+    examinar(board, offset);
+  }
+}
+
+bool Solver::restricao(const Board &board, int offset, Restricao &r) const {
+  const Cell c = board.cellAt(offset);
+  if(!cell::isRevealed(c) || cell::isMine(c)) return false;
+
+  r.tamanho = 0;
+  r.bombas = cell::count(c);
+  paraCadaVizinho(board, offset, [&](int v, Cell vizinha) {
+    if(cell::isRevealed(vizinha)) return;
+    switch(knowledge(v))
+    {
+      case Knowledge::Mine:
+        --r.bombas; break;
+      case Knowledge::Unknown:
+        r.ocultas[r.tamanho++] = v; break;
+      case Knowledge::Safe:
+        break;
+    }
+  });
+  return true;
+}
+
+void Solver::examinar(const Board &board, int offset) {
+  Restricao a;
+  if(!restricao(board, offset, a) || a.tamanho == 0) return;
+
+  // regra de célula única
+  if(a.bombas == 0 || a.bombas == a.tamanho)
+  {
+    const auto k{a.bombas == 0 ? Knowledge::Safe : Knowledge::Mine};
+    for(int n = 0; n < a.tamanho; ++n) marcar(board, a.ocultas[n], k);
+    return;
+  }
+
+  // regra de subconjunto: se as ocultas de um número estão todas entre as de
+  // outro número próximo (até 2 células de distância), a diferença tem
+  // exatamente a diferença de bombas
+  auto aplicar = [&](const Restricao &menor, const Restricao &maior) {
+    if(maior.tamanho <= menor.tamanho || !contido(menor, maior)) return false;
+    const int bombas = maior.bombas - menor.bombas;
+    const int resto = maior.tamanho - menor.tamanho;
+    if(bombas != 0 && bombas != resto) return false;
+    const auto k{bombas == 0 ? Knowledge::Safe : Knowledge::Mine};
+    for(int n = 0; n < maior.tamanho; ++n)
+    {
+      const int v = maior.ocultas[n];
+      if(std::find(menor.ocultas.begin(), menor.ocultas.begin() + menor.tamanho, v) ==
+         menor.ocultas.begin() + menor.tamanho)
+        marcar(board, v, k);
+    }
+    return true;
+  };
+
+  // só números que compartilham alguma oculta com este podem formar um
+  // subconjunto; eles ficam na janela 5x5 em volta, marcada num bitmask
+  const int i = offset / m_width;
+  const int j = offset % m_width;
+  std::uint32_t janela = 0;
+  for(int n = 0; n < a.tamanho; ++n)
+  {
+    paraCadaVizinho(board, a.ocultas[n], [&](int v, Cell c) {
+      if(v != offset && cell::isRevealed(c))
+        janela |= 1U << ((v / m_width - i + 2) * 5 + (v % m_width - j + 2));
+    });
+  }
+  for(; janela != 0; janela &= janela - 1)
+  {
+    const int bit = std::countr_zero(janela);
+    Restricao b;
+    if(!restricao(board, (i + bit / 5 - 2) * m_width + j + bit % 5 - 2, b) || b.tamanho == 0)
+      continue;
+    if(aplicar(a, b) || aplicar(b, a))
+    {
+      // outras regras de subconjunto deste número ainda podem valer
+      enfileirar(offset);
+      return;
+    }
+  }
+}
+
+void Solver::marcar(const Board &board, int offset, Knowledge k) {
+  if(knowledge(offset) != Knowledge::Unknown) return;
+  m_conhecimento[offset] = static_cast<std::uint8_t>(k);
+  if(k == Knowledge::Mine)
+    ++m_bombasConhecidas;
+  else
+    m_seguras.push_back(offset);
+
+  // os números em volta da célula perderam uma incógnita
+  enfileirar_vizinhos(board, offset);
+}
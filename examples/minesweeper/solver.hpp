@@ -0,0 +1,59 @@
+#ifndef SOLVER_HPP_
+#define SOLVER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "board.hpp"
+
+// O que o solver sabe sobre uma célula oculta
+enum class Knowledge : std::uint8_t { Unknown, Safe, Mine };
+
+// Solver determinístico por propagação de restrições. Usa apenas o que o
+// jogador vê (células reveladas e seus números; bandeiras são ignoradas) e
+// aplica as regras de célula única (todas as ocultas são bombas / nenhuma é
+// bomba) e de subconjunto entre números próximos.
+//
+// É incremental: update() recebe as células reveladas desde a última chamada
+// e só reexamina os números afetados por elas.
+class Solver {
+ public:
+  void reset(const Board& board); // reinicia e examina todo o tabuleiro visível
+  void update(const Board& board, const std::vector<int>& revealed); // examina só o que mudou
+
+  [[nodiscard]] Knowledge knowledge(int offset) const {
+    return static_cast<Knowledge>(m_conhecimento[offset]);
+  }
+  // alguma célula oculta comprovadamente segura, ou -1 se não houver
+  [[nodiscard]] int nextSafe(const Board& board);
+  [[nodiscard]] int knownMines() const { return m_bombasConhecidas; }
+
+ private:
+  int m_width{};
+  int m_height{};
+  int m_bombasConhecidas{};
+  bool m_restoMarcado{}; // regra da contagem global já aplicada
+
+  std::vector<std::uint8_t> m_conhecimento; // Knowledge de cada célula
+  std::vector<char> m_naFila; // 1 se o número já está na fila de trabalho
+  std::vector<int> m_fila; // números revelados a reexaminar
+  std::vector<int> m_seguras; // células deduzidas seguras (algumas podem já estar reveladas)
+
+  // restrição de um número revelado: ocultas ainda desconhecidas e quantas
+  // delas são bombas
+  struct Restricao {
+    std::array<int, 8> ocultas{};
+    int tamanho{};
+    int bombas{};
+  };
+
+  void enfileirar(int offset);
+  void enfileirar_vizinhos(const Board& board, int offset);
+  void propagar(const Board& board);
+  bool restricao(const Board& board, int offset, Restricao& r) const; //false se não for um número útil
+  void examinar(const Board& board, int offset);
+  void marcar(const Board& board, int offset, Knowledge k);
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef SPLITMIX_HPP_
+#define SPLITMIX_HPP_
+
+#include <cstdint>
+#include <limits>
+
+// Gerador splitmix64 (UniformRandomBitGenerator): o estado é um único
+// inteiro de 64 bits, então semear é só atribuir a semente, e cada número
+// custa algumas multiplicações. Serve onde semear um std::mt19937_64 (312
+// palavras de estado) a cada partida pesa, como nas simulações em massa.
+class SplitMix64 {
+ public:
+  using result_type = std::uint64_t;
+
+  explicit SplitMix64(std::uint64_t seed = 0) : m_estado{seed} {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()() {
+    std::uint64_t z = (m_estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+ private:
+  std::uint64_t m_estado;
+};
+
+#endif